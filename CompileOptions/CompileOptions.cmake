@@ -57,4 +57,9 @@ elseif(CMAKE_CXX_COMPILER_ID MATCHES "MSVC")
     add_compile_definitions(
         NOMINMAX # MSVC min / max issue
     )
+endif()
+
+# Enable allocator statistics
+if(KF_ALLOCATOR_STATS)
+    add_compile_definitions(KUBE_ALLOCATOR_STATS=true)
 endif()
\ No newline at end of file
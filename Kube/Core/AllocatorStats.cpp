@@ -0,0 +1,107 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Allocator statistics
+ */
+
+#include <mutex>
+
+#include "Log.hpp"
+#include "AllocatorStats.hpp"
+
+using namespace kF;
+
+/** @brief A registered named allocator */
+struct AllocatorStatsEntry
+{
+    std::string_view name {};
+    Core::AllocatorUtils::AllocatorStatsQuery query {};
+};
+
+/** @brief Registry of named allocators */
+struct AllocatorStatsRegistry
+{
+    std::mutex mutex {};
+    Core::Vector<AllocatorStatsEntry> entries {};
+};
+
+/** @brief Get the global allocator statistics registry
+ *  @note The registry is never destroyed as static allocators may be used after static destruction */
+[[nodiscard]] static AllocatorStatsRegistry &GetAllocatorStatsRegistry(void) noexcept
+{
+    static AllocatorStatsRegistry * const Registry = new AllocatorStatsRegistry {};
+
+    return *Registry;
+}
+
+void Core::AllocatorUtils::RegisterAllocatorStats(const std::string_view name, const AllocatorStatsQuery query) noexcept
+{
+    auto &registry = GetAllocatorStatsRegistry();
+    std::lock_guard lock(registry.mutex);
+
+    const auto it = std::find_if(registry.entries.begin(), registry.entries.end(),
+            [name](const auto &entry) { return entry.name == name; });
+    if (it != registry.entries.end())
+        it->query = query;
+    else
+        registry.entries.push(AllocatorStatsEntry { .name = name, .query = query });
+}
+
+void Core::AllocatorUtils::UnregisterAllocatorStats(const std::string_view name) noexcept
+{
+    auto &registry = GetAllocatorStatsRegistry();
+    std::lock_guard lock(registry.mutex);
+
+    const auto it = std::find_if(registry.entries.begin(), registry.entries.end(),
+            [name](const auto &entry) { return entry.name == name; });
+    if (it != registry.entries.end())
+        registry.entries.erase(it);
+}
+
+bool Core::AllocatorUtils::QueryAllocatorStats(const std::string_view name, AllocatorStats &stats) noexcept
+{
+    auto &registry = GetAllocatorStatsRegistry();
+    // The lock is held during the query so that the allocator can't be unregistered and destroyed meanwhile
+    std::lock_guard lock(registry.mutex);
+
+    const auto it = std::find_if(registry.entries.begin(), registry.entries.end(),
+            [name](const auto &entry) { return entry.name == name; });
+    if (it == registry.entries.end())
+        return false;
+    return it->query(stats);
+}
+
+void Core::AllocatorUtils::LogAllocatorStats(void) noexcept
+{
+    /** @brief Statistics of a registered allocator */
+    struct Snapshot
+    {
+        std::string_view name {};
+        bool found {};
+        AllocatorStats stats {};
+    };
+
+    // Snapshot statistics under lock as logging may allocate and register new allocators
+    Core::Vector<Snapshot> snapshots;
+    {
+        auto &registry = GetAllocatorStatsRegistry();
+        std::lock_guard lock(registry.mutex);
+        snapshots.reserve(registry.entries.size());
+        for (const auto &entry : registry.entries) {
+            auto &snapshot = snapshots.push(Snapshot { .name = entry.name });
+            snapshot.found = entry.query(snapshot.stats);
+        }
+    }
+
+    for (const auto &[name, found, stats] : snapshots) {
+        if (!found) {
+            kFInfo("[Allocator] ", name, ": No instance");
+            continue;
+        }
+        kFInfo("[Allocator] ", name, ": ", stats.stackCount, " stacks (", stats.stackBytes, " bytes), ",
+            stats.fragmentationCount, " fragmentations, ", stats.fallbackCount, " fallbacks (live ",
+            stats.fallbackLiveBytes, " bytes, peak ", stats.fallbackPeakBytes, " bytes)");
+        for (const auto &bucket : stats.buckets) {
+            kFInfo("\tBucket ", bucket.size, ": live ", bucket.live, ", peak ", bucket.peak, ", fragmented ", bucket.fragmented);
+        }
+    }
+}
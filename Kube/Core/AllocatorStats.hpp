@@ -0,0 +1,210 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Allocator statistics
+ */
+
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <string_view>
+
+#include "Vector.hpp"
+
+#ifndef KUBE_ALLOCATOR_STATS
+# define KUBE_ALLOCATOR_STATS false
+#endif
+
+namespace kF::Core
+{
+    /** @brief True if allocator statistics are compiled in */
+    constexpr bool AllocatorStatsEnabled = KUBE_ALLOCATOR_STATS;
+
+
+    /** @brief Statistics of a single allocator bucket */
+    struct AllocatorBucketStats
+    {
+        std::size_t size { 0u };
+        std::size_t live { 0u };
+        std::size_t peak { 0u };
+        std::size_t fragmented { 0u };
+    };
+
+    /** @brief Snapshot of allocator statistics */
+    struct AllocatorStats
+    {
+        Core::Vector<AllocatorBucketStats> buckets {};
+        std::size_t stackCount { 0u };
+        std::size_t stackBytes { 0u };
+        std::size_t fragmentationCount { 0u };
+        std::size_t fallbackCount { 0u };
+        std::size_t fallbackLiveBytes { 0u };
+        std::size_t fallbackPeakBytes { 0u };
+    };
+
+
+    namespace AllocatorUtils
+    {
+        /** @brief Query function of a named allocator, returns false if the allocator has no instance */
+        using AllocatorStatsQuery = bool(*)(AllocatorStats &stats) noexcept;
+
+        /** @brief Register a named allocator into the statistics registry (replace any previous registration) */
+        void RegisterAllocatorStats(const std::string_view name, const AllocatorStatsQuery query) noexcept;
+
+        /** @brief Unregister a named allocator, once returned no query of this allocator is running */
+        void UnregisterAllocatorStats(const std::string_view name) noexcept;
+
+        /** @brief Query statistics of a named allocator, returns false if not found */
+        [[nodiscard]] bool QueryAllocatorStats(const std::string_view name, AllocatorStats &stats) noexcept;
+
+        /** @brief Log statistics of every registered allocator */
+        void LogAllocatorStats(void) noexcept;
+
+
+        /** @brief Statistics counters embedded inside allocators
+         *  @note When KUBE_ALLOCATOR_STATS is false, counters are empty and every operation is a no-op */
+        template<std::size_t MinSizePower, std::size_t BucketCount, bool IsAtomic>
+        class StatsCounters;
+    }
+}
+
+template<std::size_t MinSizePower, std::size_t BucketCount, bool IsAtomic>
+class kF::Core::AllocatorUtils::StatsCounters
+{
+public:
+    /** @brief Counter type */
+    using Counter = std::conditional_t<IsAtomic, std::atomic<std::size_t>, std::size_t>;
+
+    /** @brief Counters of a single bucket */
+    struct alignas_cacheline BucketCounters
+    {
+        Counter live { 0u };
+        Counter peak { 0u };
+        Counter fragmented { 0u };
+    };
+
+
+    /** @brief Notify allocations from a bucket */
+    inline void onAllocate([[maybe_unused]] const std::size_t bucketIndex, [[maybe_unused]] const std::size_t count) noexcept
+    {
+#if KUBE_ALLOCATOR_STATS
+        Increment(_buckets[bucketIndex].live, _buckets[bucketIndex].peak, count);
+#endif
+    }
+
+    /** @brief Notify deallocations from a bucket */
+    inline void onDeallocate([[maybe_unused]] const std::size_t bucketIndex, [[maybe_unused]] const std::size_t count) noexcept
+    {
+#if KUBE_ALLOCATOR_STATS
+        Add(_buckets[bucketIndex].live, 0u - count);
+#endif
+    }
+
+    /** @brief Notify a block created by stack fragmentation */
+    inline void onFragmentedBlock([[maybe_unused]] const std::size_t bucketIndex) noexcept
+    {
+#if KUBE_ALLOCATOR_STATS
+        Add(_buckets[bucketIndex].fragmented, 1u);
+#endif
+    }
+
+    /** @brief Notify a stack fragmentation */
+    inline void onFragmentation(void) noexcept
+    {
+#if KUBE_ALLOCATOR_STATS
+        Add(_fragmentationCount, 1u);
+#endif
+    }
+
+    /** @brief Notify a new stack */
+    inline void onStack([[maybe_unused]] const std::size_t stackSize) noexcept
+    {
+#if KUBE_ALLOCATOR_STATS
+        Add(_stackCount, 1u);
+        Add(_stackBytes, stackSize);
+#endif
+    }
+
+    /** @brief Notify a fallback allocation */
+    inline void onFallbackAllocate([[maybe_unused]] const std::size_t size) noexcept
+    {
+#if KUBE_ALLOCATOR_STATS
+        Add(_fallbackCount, 1u);
+        Increment(_fallbackLiveBytes, _fallbackPeakBytes, size);
+#endif
+    }
+
+    /** @brief Notify a fallback deallocation */
+    inline void onFallbackDeallocate([[maybe_unused]] const std::size_t size) noexcept
+    {
+#if KUBE_ALLOCATOR_STATS
+        Add(_fallbackLiveBytes, 0u - size);
+#endif
+    }
+
+
+    /** @brief Fill a statistics snapshot */
+    void snapshot(AllocatorStats &stats) const noexcept
+    {
+        stats = AllocatorStats {};
+#if KUBE_ALLOCATOR_STATS
+        stats.buckets.resize(BucketCount);
+        for (std::uint32_t i = 0u; i != BucketCount; ++i) {
+            stats.buckets[i] = AllocatorBucketStats {
+                .size = static_cast<std::size_t>(1u) << (i + MinSizePower),
+                .live = Load(_buckets[i].live),
+                .peak = Load(_buckets[i].peak),
+                .fragmented = Load(_buckets[i].fragmented)
+            };
+        }
+        stats.stackCount = Load(_stackCount);
+        stats.stackBytes = Load(_stackBytes);
+        stats.fragmentationCount = Load(_fragmentationCount);
+        stats.fallbackCount = Load(_fallbackCount);
+        stats.fallbackLiveBytes = Load(_fallbackLiveBytes);
+        stats.fallbackPeakBytes = Load(_fallbackPeakBytes);
+#endif
+    }
+
+private:
+#if KUBE_ALLOCATOR_STATS
+    /** @brief Add a value to a counter (wrapping) */
+    static inline void Add(Counter &counter, const std::size_t value) noexcept
+    {
+        if constexpr (IsAtomic)
+            counter.fetch_add(value, std::memory_order_relaxed);
+        else
+            counter += value;
+    }
+
+    /** @brief Increment a counter and update its peak */
+    static inline void Increment(Counter &counter, Counter &peak, const std::size_t value) noexcept
+    {
+        if constexpr (IsAtomic) {
+            const auto current = counter.fetch_add(value, std::memory_order_relaxed) + value;
+            auto last = peak.load(std::memory_order_relaxed);
+            while (last < current && !peak.compare_exchange_weak(last, current, std::memory_order_relaxed));
+        } else {
+            counter += value;
+            peak = std::max(peak, counter);
+        }
+    }
+
+    /** @brief Load a counter */
+    [[nodiscard]] static inline std::size_t Load(const Counter &counter) noexcept
+    {
+        if constexpr (IsAtomic)
+            return counter.load(std::memory_order_relaxed);
+        else
+            return counter;
+    }
+
+    std::array<BucketCounters, BucketCount> _buckets {};
+    alignas_cacheline Counter _stackCount { 0u };
+    Counter _stackBytes { 0u };
+    Counter _fragmentationCount { 0u };
+    Counter _fallbackCount { 0u };
+    Counter _fallbackLiveBytes { 0u };
+    Counter _fallbackPeakBytes { 0u };
+#endif
+};
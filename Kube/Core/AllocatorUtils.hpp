@@ -27,6 +27,21 @@ namespace kF::Core
             { return AlignedFree(data, size, alignment); }
 
 
+        /** @brief Fallback batch allocate function that forwards to single allocations of any allocator
+         *  @return True on success, on failure no allocation is retained */
+        template<typename Allocator>
+        [[nodiscard]] bool FallbackAllocateBatch(Allocator &allocator,
+                const std::size_t size, const std::size_t alignment, const std::size_t count, void ** const out) noexcept;
+
+        /** @brief Fallback batch deallocate function that forwards to single deallocations of any allocator */
+        template<typename Allocator>
+        void FallbackDeallocateBatch(Allocator &allocator,
+                const std::size_t size, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept;
+
+        /** @brief Link 'count' allocations into a chain and return its tail, 'count' must not be null */
+        [[nodiscard]] AllocationHeader *LinkAllocationChain(void * const * const data, const std::size_t count) noexcept;
+
+
         /** @brief Get the bucket index of a runtime size considering the minimal power size of the allocator (constant time) */
         template<std::size_t MinSizePower>
         [[nodiscard]] std::size_t GetBucketIndex(const std::size_t size) noexcept;
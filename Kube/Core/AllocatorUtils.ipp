@@ -5,6 +5,42 @@
 
 #include "AllocatorUtils.hpp"
 
+template<typename Allocator>
+inline bool kF::Core::AllocatorUtils::FallbackAllocateBatch(Allocator &allocator,
+        const std::size_t size, const std::size_t alignment, const std::size_t count, void ** const out) noexcept
+{
+    for (std::size_t i = 0u; i != count; ++i) {
+        out[i] = allocator.allocate(size, alignment);
+        if (!out[i]) [[unlikely]] {
+            FallbackDeallocateBatch(allocator, size, alignment, i, out);
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename Allocator>
+inline void kF::Core::AllocatorUtils::FallbackDeallocateBatch(Allocator &allocator,
+        const std::size_t size, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept
+{
+    for (std::size_t i = 0u; i != count; ++i)
+        allocator.deallocate(data[i], size, alignment);
+}
+
+inline kF::Core::AllocatorUtils::AllocationHeader *kF::Core::AllocatorUtils::LinkAllocationChain(
+        void * const * const data, const std::size_t count) noexcept
+{
+    auto tail = reinterpret_cast<AllocationHeader *>(data[0]);
+
+    for (std::size_t i = 1u; i != count; ++i) {
+        const auto next = reinterpret_cast<AllocationHeader *>(data[i]);
+        tail->next = next;
+        tail = next;
+    }
+    tail->next = nullptr;
+    return tail;
+}
+
 template<std::size_t MinSizePower>
 inline std::size_t kF::Core::AllocatorUtils::GetBucketIndex(const std::size_t size) noexcept
 {
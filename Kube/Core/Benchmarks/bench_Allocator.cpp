@@ -13,6 +13,9 @@
 
 #include <Kube/Core/MacroUtils.hpp>
 #include <Kube/Core/UnsafeAllocator.hpp>
+#include <Kube/Core/SafeAllocator.hpp>
+#include <Kube/Core/SizeClassAllocator.hpp>
+#include <Kube/Core/SPSCQueue.hpp>
 #include <Kube/Core/AllocatedVector.hpp>
 
 using namespace kF;
@@ -212,6 +215,61 @@ void NoisyThread_VectorPushBack_FixedSize(benchmark::State &state)
         thd.join();
 }
 
+template<typename Allocator, std::size_t Size, std::size_t NoisyThreadCount>
+void ProducerConsumer_FixedSize(benchmark::State &state)
+{
+    constexpr std::size_t BatchCount = 1024;
+
+    Allocator allocator;
+    Core::SPSCQueue<void *> queue(BatchCount);
+    std::atomic_bool running { true };
+
+    // Consumer thread deallocates everything the producer allocates
+    std::thread consumer([&allocator, &queue, &running] {
+        void *ptr {};
+        while (running.load(std::memory_order_relaxed)) {
+            while (queue.pop(ptr))
+                allocator.deallocate(ptr, Size, Size);
+        }
+        while (queue.pop(ptr))
+            allocator.deallocate(ptr, Size, Size);
+    });
+
+    // Noisy threads allocate and deallocate within the same size class
+    std::vector<std::thread> noisyThreads;
+    for (std::size_t i = 0u; i != NoisyThreadCount; ++i) {
+        noisyThreads.emplace_back([&allocator, &running] {
+            void *ptrs[16] {};
+            while (running.load(std::memory_order_relaxed)) {
+                for (auto &ptr : ptrs)
+                    ptr = allocator.allocate(Size, Size);
+                for (auto &ptr : ptrs)
+                    allocator.deallocate(ptr, Size, Size);
+            }
+        });
+    }
+
+    while (state.KeepRunning()) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (std::size_t i = 0u; i != BatchCount; ++i) {
+            auto ptr = allocator.allocate(Size, Size);
+            benchmark::DoNotOptimize(ptr);
+            while (!queue.push(ptr));
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed.count());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * BatchCount));
+
+    running = false;
+    consumer.join();
+    for (auto &thd : noisyThreads)
+        thd.join();
+}
+
 #define GENERATE_ALLOCDEALLOC_FIXEDSIZE(AllocatorName, AllocatorType, Size, Alignment) \
 static void AllocatorName##_AllocDealloc_FixedSize_##Size##_##Alignment(benchmark::State &state) \
     { return AllocDealloc_FixedSize<AllocatorType, Size, Alignment>(state); } \
@@ -244,6 +302,67 @@ static void AllocatorName##_NoisyThread_VectorPushBack_FixedSize_##TypeName##_##
 BENCHMARK(AllocatorName##_NoisyThread_VectorPushBack_FixedSize_##TypeName##_##PushCount)
 
 
+/** @brief Stack provider that tracks the amount of stack memory reserved by allocators */
+struct CountingStackProvider
+{
+    static inline std::atomic_size_t ReservedBytes {};
+
+    [[nodiscard]] static void *AllocateStack(const std::size_t size, const std::size_t alignment) noexcept
+        { ReservedBytes += size; return Core::DefaultStackProvider::AllocateStack(size, alignment); }
+
+    static void DeallocateStack(void * const data, const std::size_t size, const std::size_t alignment) noexcept
+        { ReservedBytes -= size; Core::DefaultStackProvider::DeallocateStack(data, size, alignment); }
+};
+
+template<typename Allocator, std::size_t RetentionCount>
+void Footprint_MixedSize(benchmark::State &state)
+{
+    // Typical sizes of runtime allocations (tasks, functors, small vectors)
+    constexpr std::size_t Sizes[] { 24, 40, 72, 96, 136, 200, 320, 520 };
+    constexpr std::size_t SizeCount = sizeof(Sizes) / sizeof(*Sizes);
+
+    RetentionVector retentions;
+    retentions.reserve(RetentionCount);
+    std::size_t requestedBytes {};
+    std::size_t reservedBytes {};
+
+    while (state.KeepRunning()) {
+        CountingStackProvider::ReservedBytes = 0u;
+        Allocator allocator;
+        requestedBytes = 0u;
+        for (std::size_t i = 0u; i != RetentionCount; ++i) {
+            const auto size = Sizes[i % SizeCount];
+            retentions.push_back(Allocation { allocator.allocate(size, alignof(std::max_align_t)), size, alignof(std::max_align_t) });
+            requestedBytes += size;
+        }
+        reservedBytes = CountingStackProvider::ReservedBytes;
+        for (const auto &allocation : retentions)
+            allocator.deallocate(allocation.data, allocation.size, allocation.alignment);
+        retentions.clear();
+    }
+    state.counters["RequestedBytes"] = static_cast<double>(requestedBytes);
+    state.counters["ReservedBytes"] = static_cast<double>(reservedBytes);
+    state.counters["Overhead"] = static_cast<double>(reservedBytes) / static_cast<double>(requestedBytes);
+}
+
+#define GENERATE_PRODUCERCONSUMER_FIXEDSIZE(AllocatorName, AllocatorType, Size, NoisyThreadCount) \
+static void AllocatorName##_ProducerConsumer_FixedSize_##Size##_##NoisyThreadCount(benchmark::State &state) \
+    { return ProducerConsumer_FixedSize<AllocatorType, Size, NoisyThreadCount>(state); } \
+BENCHMARK(AllocatorName##_ProducerConsumer_FixedSize_##Size##_##NoisyThreadCount)->UseManualTime()
+
+#define GENERATE_FOOTPRINT_MIXEDSIZE(AllocatorName, AllocatorType, RetentionCount) \
+static void AllocatorName##_Footprint_MixedSize_##RetentionCount(benchmark::State &state) \
+    { return Footprint_MixedSize<AllocatorType, RetentionCount>(state); } \
+BENCHMARK(AllocatorName##_Footprint_MixedSize_##RetentionCount)
+
+#define GENERATE_PRODUCERCONSUMER_TESTS(AllocatorName, AllocatorType) \
+    GENERATE_PRODUCERCONSUMER_FIXEDSIZE(AllocatorName, AllocatorType, 32, 0); \
+    GENERATE_PRODUCERCONSUMER_FIXEDSIZE(AllocatorName, AllocatorType, 32, 2); \
+    GENERATE_PRODUCERCONSUMER_FIXEDSIZE(AllocatorName, AllocatorType, 256, 0); \
+    GENERATE_PRODUCERCONSUMER_FIXEDSIZE(AllocatorName, AllocatorType, 256, 2); \
+    GENERATE_PRODUCERCONSUMER_FIXEDSIZE(AllocatorName, AllocatorType, 2048, 0); \
+    GENERATE_PRODUCERCONSUMER_FIXEDSIZE(AllocatorName, AllocatorType, 2048, 2);
+
 #define GENERATE_POW2_TESTS(AllocatorName, AllocatorType, TESTNAME, ...) \
     TESTNAME(AllocatorName, AllocatorType, 8 __VA_OPT__(, __VA_ARGS__)); \
     TESTNAME(AllocatorName, AllocatorType, 16 __VA_OPT__(, __VA_ARGS__)); \
@@ -294,3 +413,18 @@ BENCHMARK(AllocatorName##_NoisyThread_VectorPushBack_FixedSize_##TypeName##_##Pu
 // GENERATE_TESTS_INSTANCE(NoAllocator, NoAllocator)
 // GENERATE_TESTS_INSTANCE(UnsynchronizedStandardAllocator, std::pmr::unsynchronized_pool_resource)
 GENERATE_TESTS_INSTANCE(UnsafeAllocator, Core::UnsafeAllocator<>)
+
+using MagazineSafeAllocator = Core::SafeAllocator<5, 12, 16, 64>;
+using RemoteFreeSafeAllocator = Core::SafeAllocator<5, 12, 16, 64, Core::DefaultStackProvider, true>;
+
+GENERATE_PRODUCERCONSUMER_TESTS(NoAllocator, NoAllocator)
+GENERATE_PRODUCERCONSUMER_TESTS(SafeAllocator, Core::SafeAllocator<>)
+GENERATE_PRODUCERCONSUMER_TESTS(MagazineSafeAllocator, MagazineSafeAllocator)
+GENERATE_PRODUCERCONSUMER_TESTS(RemoteFreeSafeAllocator, RemoteFreeSafeAllocator)
+GENERATE_PRODUCERCONSUMER_TESTS(SizeClassAllocator, Core::SizeClassAllocator<>)
+
+using CountingSafeAllocator = Core::SafeAllocator<5, 12, 16, 0, CountingStackProvider>;
+using CountingSizeClassAllocator = Core::SizeClassAllocator<5, 12, 16, 2, CountingStackProvider>;
+
+GENERATE_FOOTPRINT_MIXEDSIZE(SafeAllocator, CountingSafeAllocator, 10000);
+GENERATE_FOOTPRINT_MIXEDSIZE(SizeClassAllocator, CountingSizeClassAllocator, 10000);
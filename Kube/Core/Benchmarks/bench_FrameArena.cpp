@@ -0,0 +1,79 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of frame arena against general purpose allocators
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/FrameArena.hpp>
+#include <Kube/Core/StaticSafeAllocator.hpp>
+#include <Kube/Core/Vector.hpp>
+
+using namespace kF;
+
+/** @brief Allocator similar to UIAllocator */
+struct BenchUIAllocator : Core::StaticSafeAllocator<"BenchUIAllocator"> {};
+
+/** @brief Frame arena of the benchmark */
+using BenchFrameArena = Core::FrameArena<"BenchFrameArena">;
+
+/** @brief Data resolved for each child of a node, similar to layout resolve data */
+struct ChildData
+{
+    float width {};
+    float height {};
+    std::uint32_t index {};
+};
+
+/** @brief Simulate a layout traversal creating per node temporaries
+ *  Each node of a tree of depth 'Depth' and 'ChildCount' children per node resolves its children into a temporary vector,
+ *  while the traversal stack is recorded just like an hover stack */
+template<typename Allocator, std::uint32_t ChildCount>
+static float TraverseLayout(const std::uint32_t depth, Core::Vector<std::uint32_t, Allocator> &stack, const std::uint32_t index) noexcept
+{
+    stack.push(index);
+    if (!depth) {
+        stack.pop();
+        return static_cast<float>(index % 7u);
+    }
+
+    Core::Vector<ChildData, Allocator> children;
+    float size {};
+    for (std::uint32_t i = 0; i != ChildCount; ++i) {
+        const auto childIndex = index * ChildCount + i;
+        const auto childSize = TraverseLayout<Allocator, ChildCount>(depth - 1, stack, childIndex);
+        children.push(ChildData { .width = childSize, .height = childSize * 2.0f, .index = childIndex });
+    }
+    for (const auto &child : children)
+        size += child.width + child.height;
+    stack.pop();
+    return size;
+}
+
+template<typename Allocator, std::uint32_t Depth, std::uint32_t ChildCount>
+static void LayoutTemporaries(benchmark::State &state)
+{
+    for (auto _ : state) {
+        {
+            Core::Vector<std::uint32_t, Allocator> stack;
+            benchmark::DoNotOptimize(TraverseLayout<Allocator, ChildCount>(Depth, stack, 0u));
+        }
+        // Reset the arena at the end of each frame, just like an ECS pipeline does
+        if constexpr (requires { Allocator::Reset(); })
+            Allocator::Reset();
+    }
+}
+
+#define GENERATE_LAYOUT_TEMPORARIES(AllocatorName, AllocatorType, Depth, ChildCount) \
+static void AllocatorName##_LayoutTemporaries_##Depth##_##ChildCount(benchmark::State &state) \
+    { LayoutTemporaries<AllocatorType, Depth, ChildCount>(state); } \
+BENCHMARK(AllocatorName##_LayoutTemporaries_##Depth##_##ChildCount);
+
+#define GENERATE_LAYOUT_TEMPORARIES_TESTS(AllocatorName, AllocatorType) \
+GENERATE_LAYOUT_TEMPORARIES(AllocatorName, AllocatorType, 4, 4) \
+GENERATE_LAYOUT_TEMPORARIES(AllocatorName, AllocatorType, 6, 4) \
+GENERATE_LAYOUT_TEMPORARIES(AllocatorName, AllocatorType, 3, 16)
+
+GENERATE_LAYOUT_TEMPORARIES_TESTS(Default, Core::DefaultStaticAllocator)
+GENERATE_LAYOUT_TEMPORARIES_TESTS(UIAllocator, BenchUIAllocator)
+GENERATE_LAYOUT_TEMPORARIES_TESTS(FrameArena, BenchFrameArena)
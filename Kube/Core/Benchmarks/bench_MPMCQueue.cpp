@@ -126,3 +126,72 @@ static void MPMCQueue_NoisyPop_##Capacity##_##PushCount##_##PopCount(benchmark::
 BENCHMARK(MPMCQueue_NoisyPop_##Capacity##_##PushCount##_##PopCount)->UseManualTime();
 
 GENERATE_TESTS_THREADS(MPMCQUEUE_NOISY_POP);
+
+#define GENERATE_BATCH_TESTS(TEST) \
+    TEST(4096, 1) \
+    TEST(4096, 8) \
+    TEST(4096, 64)
+
+/** @brief Push then pop the whole queue by batches (a batch of 1 uses single push / pop) */
+#define MPMCQUEUE_SINGLETHREADED_BATCH(Capacity, BatchSize) \
+static void MPMCQueue_SingleThreadedBatch_##Capacity##_##BatchSize(benchmark::State &state) \
+{ \
+    Queue queue(Capacity); \
+    std::size_t values[BatchSize] {}; \
+    for (auto _ : state) { \
+        auto start = std::chrono::high_resolution_clock::now(); \
+        for (auto j = 0ul; j < Capacity; j += BatchSize) { \
+            if constexpr (BatchSize == 1) \
+                benchmark::DoNotOptimize(queue.push(values[0])); \
+            else \
+                benchmark::DoNotOptimize(queue.pushRange(values, values + BatchSize)); \
+        } \
+        for (auto j = 0ul; j < Capacity; j += BatchSize) { \
+            if constexpr (BatchSize == 1) \
+                benchmark::DoNotOptimize(queue.pop(values[0])); \
+            else \
+                benchmark::DoNotOptimize(queue.popRange(values, values + BatchSize)); \
+        } \
+        auto end = std::chrono::high_resolution_clock::now(); \
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+        state.SetIterationTime(elapsed.count()); \
+    } \
+} \
+BENCHMARK(MPMCQueue_SingleThreadedBatch_##Capacity##_##BatchSize)->UseManualTime();
+
+GENERATE_BATCH_TESTS(MPMCQUEUE_SINGLETHREADED_BATCH)
+
+/** @brief Push 'Capacity' elements by batches while a consumer thread pops by batches */
+#define MPMCQUEUE_PRODUCER_CONSUMER_BATCH(Capacity, BatchSize) \
+static void MPMCQueue_ProducerConsumerBatch_##Capacity##_##BatchSize(benchmark::State &state) \
+{ \
+    Queue queue(Capacity); \
+    std::atomic<bool> running = true; \
+    std::thread thd([&queue, &running] { \
+        std::size_t values[BatchSize]; \
+        while (running.load(std::memory_order_relaxed)) { \
+            if constexpr (BatchSize == 1) \
+                benchmark::DoNotOptimize(queue.pop(values[0])); \
+            else \
+                benchmark::DoNotOptimize(queue.popRange(values, values + BatchSize)); \
+        } \
+    }); \
+    std::size_t values[BatchSize] {}; \
+    for (auto _ : state) { \
+        auto start = std::chrono::high_resolution_clock::now(); \
+        for (auto j = 0ul; j < Capacity;) { \
+            if constexpr (BatchSize == 1) \
+                j += queue.push(values[0]); \
+            else \
+                j += queue.pushRange(values, values + BatchSize); \
+        } \
+        auto end = std::chrono::high_resolution_clock::now(); \
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+        state.SetIterationTime(elapsed.count()); \
+    } \
+    running = false; \
+    thd.join(); \
+} \
+BENCHMARK(MPMCQueue_ProducerConsumerBatch_##Capacity##_##BatchSize)->UseManualTime();
+
+GENERATE_BATCH_TESTS(MPMCQUEUE_PRODUCER_CONSUMER_BATCH)
@@ -0,0 +1,58 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of SegmentedMPSCQueue class
+ */
+
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/MPSCQueue.hpp>
+#include <Kube/Core/SegmentedMPSCQueue.hpp>
+
+using namespace kF;
+
+using BoundedQueue = Core::MPSCQueue<std::size_t>;
+using SegmentedQueue = Core::SegmentedMPSCQueue<std::size_t, Core::DefaultStaticAllocator, 512>;
+
+/** @brief Capacity of the bounded queue, bursts overflow it */
+constexpr std::size_t BoundedCapacity = 512;
+
+#define GENERATE_TESTS(TEST, ...) \
+    TEST(256 __VA_OPT__(,) __VA_ARGS__) \
+    TEST(4096 __VA_OPT__(,) __VA_ARGS__) \
+    TEST(65536 __VA_OPT__(,) __VA_ARGS__)
+
+/** @brief Push a burst of 'Burst' elements while a consumer thread drains the queue
+ *  The measured time is the stall of the sender: once the bounded queue is full the sender has to retry */
+#define MPSCQUEUE_BURST(Name, QueueType, Burst, ...) \
+static void Name##_Burst_##Burst(benchmark::State &state) \
+{ \
+    QueueType queue __VA_ARGS__; \
+    std::atomic<bool> running = true; \
+    std::thread thd([&queue, &running] { \
+        for (std::size_t tmp; running.load(std::memory_order_relaxed);) { \
+            if (!queue.pop(tmp)) \
+                std::this_thread::yield(); \
+        } \
+    }); \
+    for (auto _ : state) { \
+        auto start = std::chrono::high_resolution_clock::now(); \
+        for (auto i = 0ul; i < Burst; ++i) { \
+            while (!queue.push(i)) \
+                std::this_thread::yield(); \
+        } \
+        auto end = std::chrono::high_resolution_clock::now(); \
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+        state.SetIterationTime(elapsed.count()); \
+    } \
+    running = false; \
+    thd.join(); \
+} \
+BENCHMARK(Name##_Burst_##Burst)->UseManualTime();
+
+#define BOUNDED_MPSCQUEUE_BURST(Burst) MPSCQUEUE_BURST(BoundedMPSCQueue, BoundedQueue, Burst, (BoundedCapacity))
+#define SEGMENTED_MPSCQUEUE_BURST(Burst) MPSCQUEUE_BURST(SegmentedMPSCQueue, SegmentedQueue, Burst)
+
+GENERATE_TESTS(BOUNDED_MPSCQUEUE_BURST)
+GENERATE_TESTS(SEGMENTED_MPSCQUEUE_BURST)
@@ -0,0 +1,180 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: CPU topology discovery and thread affinity
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "Platform.hpp"
+#include "CpuTopology.hpp"
+
+#if KUBE_PLATFORM_WINDOWS
+# include <windows.h>
+#elif KUBE_PLATFORM_LINUX
+# include <sched.h>
+#endif
+
+using namespace kF;
+
+#if KUBE_PLATFORM_LINUX
+
+/** @brief Maximum length of a sysfs file read by the discovery */
+constexpr std::size_t SysFileMaxLength = 4096;
+
+/** @brief Read a small sysfs file into 'buffer' (null terminated) */
+[[nodiscard]] static bool ReadSysFile(const char * const path, char (&buffer)[SysFileMaxLength]) noexcept
+{
+    const auto file = std::fopen(path, "r");
+    if (!file) [[unlikely]]
+        return false;
+    const auto length = std::fread(buffer, 1, SysFileMaxLength - 1, file);
+    std::fclose(file);
+    buffer[length] = '\0';
+    return length != 0;
+}
+
+/** @brief Parse a sysfs list (ex: '0-3,8,10-11') calling 'callback' for each value */
+template<typename Callback>
+static bool ReadSysList(const char * const path, Callback &&callback) noexcept
+{
+    char buffer[SysFileMaxLength];
+    if (!ReadSysFile(path, buffer))
+        return false;
+
+    for (const char *it = buffer; *it >= '0' && *it <= '9';) {
+        char *end {};
+        const auto from = std::strtoul(it, &end, 10);
+        auto to = from;
+        if (*end == '-')
+            to = std::strtoul(end + 1, &end, 10);
+        for (auto value = from; value <= to; ++value)
+            callback(static_cast<std::uint32_t>(value));
+        it = *end == ',' ? end + 1 : end;
+    }
+    return true;
+}
+
+/** @brief Read a single integer from a sysfs file */
+[[nodiscard]] static bool ReadSysValue(const char * const path, std::uint32_t &value) noexcept
+{
+    bool found { false };
+    ReadSysList(path, [&value, &found](const std::uint32_t read) {
+        if (!found)
+            value = read;
+        found = true;
+    });
+    return found;
+}
+
+/** @brief Get the key of the last level cache of a CPU, fallback to its package if caches are not exposed */
+[[nodiscard]] static std::uint32_t GetCacheKey(const std::uint32_t cpu) noexcept
+{
+    char path[128];
+    std::uint32_t bestLevel {}, key { ~static_cast<std::uint32_t>(0) };
+
+    for (std::uint32_t index = 0; ; ++index) {
+        std::uint32_t level {};
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+        if (!ReadSysValue(path, level))
+            break;
+        if (level < bestLevel)
+            continue;
+        // The first CPU sharing the cache identifies it
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", cpu, index);
+        if (std::uint32_t first {}; ReadSysValue(path, first)) {
+            bestLevel = level;
+            key = first;
+        }
+    }
+    if (bestLevel)
+        return key;
+
+    // Caches are not exposed, use the physical package (keys are offset to never collide with a CPU index)
+    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+    if (std::uint32_t package {}; ReadSysValue(path, package))
+        return key - package;
+    return key;
+}
+
+#endif
+
+/** @brief Get the dense index of a key, inserting it if not found */
+[[nodiscard]] static std::uint32_t GetDenseIndex(Core::Vector<std::uint32_t> &keys, const std::uint32_t key) noexcept
+{
+    if (const auto it = keys.find(key); it != keys.end())
+        return static_cast<std::uint32_t>(std::distance(keys.begin(), it));
+    keys.push(key);
+    return keys.size() - 1;
+}
+
+Core::CpuTopology Core::CpuTopology::Discover(void) noexcept
+{
+    CpuTopology topology;
+    Core::Vector<std::uint32_t> nodeKeys, cacheKeys;
+
+#if KUBE_PLATFORM_LINUX
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (!sched_getaffinity(0, sizeof(set), &set)) [[likely]] {
+        for (std::uint32_t cpu = 0; cpu != CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set))
+                topology._cpus.push(CpuInfo { .index = cpu });
+        }
+    }
+
+    // Assign nodes from their CPU lists
+    ReadSysList("/sys/devices/system/node/online", [&topology, &nodeKeys](const std::uint32_t node) {
+        char path[128];
+        std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+        ReadSysList(path, [&topology, &nodeKeys, node](const std::uint32_t cpu) {
+            const auto it = topology._cpus.find([cpu](const CpuInfo &info) { return info.index == cpu; });
+            if (it != topology._cpus.end())
+                it->node = GetDenseIndex(nodeKeys, node);
+        });
+    });
+
+    // Assign last level cache groups
+    for (auto &cpu : topology._cpus)
+        cpu.cacheGroup = GetDenseIndex(cacheKeys, GetCacheKey(cpu.index));
+#endif
+
+    // Fallback to a flat topology
+    if (topology._cpus.empty()) [[unlikely]] {
+        const auto count = std::max(std::thread::hardware_concurrency(), 1u);
+        for (std::uint32_t cpu = 0; cpu != count; ++cpu)
+            topology._cpus.push(CpuInfo { .index = cpu });
+    }
+
+    std::sort(topology._cpus.begin(), topology._cpus.end(), [](const CpuInfo &lhs, const CpuInfo &rhs) {
+        if (lhs.node != rhs.node)
+            return lhs.node < rhs.node;
+        else if (lhs.cacheGroup != rhs.cacheGroup)
+            return lhs.cacheGroup < rhs.cacheGroup;
+        else
+            return lhs.index < rhs.index;
+    });
+    topology._nodeCount = std::max(nodeKeys.size(), 1u);
+    topology._cacheGroupCount = std::max(cacheKeys.size(), 1u);
+    return topology;
+}
+
+bool Core::CpuTopology::PinCurrentThread([[maybe_unused]] const std::uint32_t cpuIndex) noexcept
+{
+#if KUBE_PLATFORM_LINUX
+    if (cpuIndex >= CPU_SETSIZE) [[unlikely]]
+        return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpuIndex, &set);
+    return !sched_setaffinity(0, sizeof(set), &set);
+#elif KUBE_PLATFORM_WINDOWS
+    if (cpuIndex >= sizeof(DWORD_PTR) * 8) [[unlikely]]
+        return false;
+    return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpuIndex) != 0;
+#else
+    return false;
+#endif
+}
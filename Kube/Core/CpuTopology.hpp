@@ -0,0 +1,55 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: CPU topology discovery and thread affinity
+ */
+
+#pragma once
+
+#include "Vector.hpp"
+
+namespace kF::Core
+{
+    struct CpuInfo;
+    class CpuTopology;
+}
+
+/** @brief Location of a logical CPU */
+struct kF::Core::CpuInfo
+{
+    std::uint32_t index {}; // Logical CPU index, as used by affinity masks
+    std::uint32_t node {}; // NUMA node index
+    std::uint32_t cacheGroup {}; // Index of the group of CPUs sharing the last level cache
+};
+
+/** @brief Topology of the logical CPUs available to the process
+ *  On Linux the topology is read from /sys, other platforms report a flat topology (single node & cache group) */
+class kF::Core::CpuTopology
+{
+public:
+    /** @brief List of CPUs */
+    using CpuList = Core::Vector<CpuInfo>;
+
+
+    /** @brief Discover the topology of the CPUs the process is allowed to run on
+     *  CPUs are sorted by node, then cache group, then index */
+    [[nodiscard]] static CpuTopology Discover(void) noexcept;
+
+    /** @brief Pin the calling thread to a logical CPU
+     *  @return True on success */
+    static bool PinCurrentThread(const std::uint32_t cpuIndex) noexcept;
+
+
+    /** @brief Get CPU list */
+    [[nodiscard]] inline const CpuList &cpus(void) const noexcept { return _cpus; }
+
+    /** @brief Get number of NUMA nodes */
+    [[nodiscard]] inline std::uint32_t nodeCount(void) const noexcept { return _nodeCount; }
+
+    /** @brief Get number of last level cache groups */
+    [[nodiscard]] inline std::uint32_t cacheGroupCount(void) const noexcept { return _cacheGroupCount; }
+
+private:
+    CpuList _cpus {};
+    std::uint32_t _nodeCount {};
+    std::uint32_t _cacheGroupCount {};
+};
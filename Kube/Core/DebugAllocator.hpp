@@ -63,6 +63,14 @@ public:
         Base::deallocate(data, size, alignment);
     }
 
+    /** @brief Batch allocate function implementation, tracked as single allocations */
+    [[nodiscard]] bool allocateBatch(const std::size_t size, const std::size_t alignment, const std::size_t count, void ** const out) noexcept override
+        { return AllocatorUtils::FallbackAllocateBatch(*this, size, alignment, count, out); }
+
+    /** @brief Batch deallocate function implementation, tracked as single deallocations */
+    void deallocateBatch(const std::size_t size, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept override
+        { AllocatorUtils::FallbackDeallocateBatch(*this, size, alignment, count, data); }
+
 private:
     std::mutex _m {};
     Core::String _name {};
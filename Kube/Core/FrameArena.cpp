@@ -0,0 +1,97 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Frame arena allocator
+ */
+
+#include <new>
+
+#include "Abort.hpp"
+#include "Assert.hpp"
+#include "FrameArena.hpp"
+
+using namespace kF;
+
+/** @brief Get the allocation size of a chunk */
+[[nodiscard]] static inline std::size_t GetChunkAllocationSize(const Core::FrameArenaState::Chunk * const chunk) noexcept
+{
+    return sizeof(Core::FrameArenaState::Chunk) + chunk->capacity;
+}
+
+void *Core::FrameArenaState::allocateSlow(Chunk * const expected, const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    std::unique_lock lock(_mutex);
+    auto current = _current.load(std::memory_order_relaxed);
+
+    // Another thread already switched the current chunk
+    if (current != expected) [[unlikely]] {
+        lock.unlock();
+        return allocate(bytes, alignment);
+    }
+
+    // Pick the next chunk kept from previous frames if it is large enough
+    const auto requiredCapacity = bytes + (alignment > alignof(Chunk) ? alignment : 0u);
+    Chunk *next = current ? current->next : _first;
+    if (!next || next->capacity < requiredCapacity) {
+        const auto capacity = std::max(_chunkSize, requiredCapacity);
+        const auto chunk = Core::AlignedAlloc<Chunk>(sizeof(Chunk) + capacity, alignof(Chunk));
+        kFEnsure(chunk, "Core::FrameArena: Out of memory");
+        new (chunk) Chunk { .capacity = capacity, .next = next };
+        if (current)
+            current->next = chunk;
+        else
+            _first = chunk;
+        next = chunk;
+    }
+
+    // Chunks are reset lazily, when they become current
+    next->head.store(0u, std::memory_order_relaxed);
+    const auto data = TryAllocate(next, bytes, alignment);
+    _current.store(next, std::memory_order_release);
+    return data;
+}
+
+void Core::FrameArenaState::reset(void) noexcept
+{
+    std::lock_guard lock(_mutex);
+
+    if (_first) [[likely]]
+        _first->head.store(0u, std::memory_order_relaxed);
+    _current.store(_first, std::memory_order_release);
+}
+
+void Core::FrameArenaState::release(void) noexcept
+{
+    std::lock_guard lock(_mutex);
+
+    for (auto chunk = _first; chunk;) {
+        const auto next = chunk->next;
+        Core::AlignedFree(chunk, GetChunkAllocationSize(chunk), alignof(Chunk));
+        chunk = next;
+    }
+    _first = nullptr;
+    _current.store(nullptr, std::memory_order_release);
+}
+
+std::size_t Core::FrameArenaState::reservedBytes(void) const noexcept
+{
+    std::lock_guard lock(_mutex);
+    std::size_t bytes { 0u };
+
+    for (auto chunk = _first; chunk; chunk = chunk->next)
+        bytes += chunk->capacity;
+    return bytes;
+}
+
+std::size_t Core::FrameArenaState::usedBytes(void) const noexcept
+{
+    std::lock_guard lock(_mutex);
+    const auto current = _current.load(std::memory_order_relaxed);
+    std::size_t bytes { 0u };
+
+    if (current) [[likely]] {
+        for (auto chunk = _first; chunk != current; chunk = chunk->next)
+            bytes += chunk->head.load(std::memory_order_relaxed);
+        bytes += current->head.load(std::memory_order_relaxed);
+    }
+    return bytes;
+}
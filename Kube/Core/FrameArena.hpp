@@ -0,0 +1,116 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Frame arena allocator
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "FixedString.hpp"
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    class FrameArenaState;
+
+    template<kF::Core::FixedString Name, std::size_t ChunkSize = 64 * 1024>
+    class FrameArena;
+}
+
+/** @brief Thread safe bump allocator state, used by FrameArena
+ *  Strength:   + Allocation is a single atomic bump in the current chunk
+ *              + Reset is O(1), chunks are kept and reused across frames
+ *  Weakness:   - Deallocation is a no-op, memory is only reclaimed on reset
+ *              - Reset must not run concurrently with any allocation */
+class alignas_cacheline kF::Core::FrameArenaState
+{
+public:
+    /** @brief Header of a chunk, its data follows in memory */
+    struct alignas_cacheline Chunk
+    {
+        std::atomic<std::size_t> head {};
+        std::size_t capacity {};
+        Chunk *next {};
+    };
+
+
+    /** @brief Destructor */
+    inline ~FrameArenaState(void) noexcept { release(); }
+
+    /** @brief Constructor */
+    inline FrameArenaState(const std::size_t chunkSize) noexcept : _chunkSize(chunkSize) {}
+
+    /** @brief FrameArenaState is not copiable */
+    FrameArenaState(const FrameArenaState &other) noexcept = delete;
+    FrameArenaState &operator=(const FrameArenaState &other) noexcept = delete;
+
+
+    /** @brief Allocate memory from the current chunk */
+    [[nodiscard]] inline void *allocate(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Reset the arena, every allocation is invalidated */
+    void reset(void) noexcept;
+
+    /** @brief Release every chunk */
+    void release(void) noexcept;
+
+
+    /** @brief Get the number of bytes reserved by chunks */
+    [[nodiscard]] std::size_t reservedBytes(void) const noexcept;
+
+    /** @brief Get the number of bytes bumped since last reset (including alignment padding) */
+    [[nodiscard]] std::size_t usedBytes(void) const noexcept;
+
+private:
+    /** @brief Try to bump an allocation into a chunk */
+    [[nodiscard]] static inline void *TryAllocate(Chunk * const chunk, const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Switch current chunk to a chunk able to hold an allocation then allocate it */
+    [[nodiscard]] void *allocateSlow(Chunk * const expected, const std::size_t bytes, const std::size_t alignment) noexcept;
+
+
+    // Cacheline 0
+    std::atomic<Chunk *> _current {};
+    // Cacheline 1
+    alignas_cacheline mutable std::mutex _mutex {};
+    Chunk *_first {};
+    std::size_t _chunkSize {};
+};
+
+/** @brief Static frame arena, satisfying StaticAllocatorRequirements
+ *  Intended for temporaries that are created and discarded every frame (see ECS pipeline frame arenas)
+ *  @param Name Unique name of the arena
+ *  @param ChunkSize Default size of a chunk (larger allocations get a dedicated chunk) */
+template<kF::Core::FixedString Name, std::size_t ChunkSize>
+class kF::Core::FrameArena
+{
+public:
+    /** @brief Allocate memory that lives until next reset */
+    [[nodiscard]] static inline void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { return _State.allocate(bytes, alignment); }
+
+    /** @brief Deallocation is a no-op, memory is reclaimed on reset */
+    static inline void Deallocate([[maybe_unused]] void * const data, [[maybe_unused]] const std::size_t bytes, [[maybe_unused]] const std::size_t alignment) noexcept {}
+
+
+    /** @brief Reset the arena in O(1), every allocation is invalidated
+     *  @note Must not be called concurrently with any allocation */
+    static inline void Reset(void) noexcept { _State.reset(); }
+
+    /** @brief Release every chunk of the arena, every allocation is invalidated */
+    static inline void Release(void) noexcept { _State.release(); }
+
+
+    /** @brief Get the number of bytes reserved by the arena */
+    [[nodiscard]] static inline std::size_t ReservedBytes(void) noexcept { return _State.reservedBytes(); }
+
+    /** @brief Get the number of bytes used since last reset */
+    [[nodiscard]] static inline std::size_t UsedBytes(void) noexcept { return _State.usedBytes(); }
+
+private:
+    static inline FrameArenaState _State { ChunkSize };
+};
+
+#include "FrameArena.ipp"
@@ -0,0 +1,32 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Frame arena allocator
+ */
+
+#include "FrameArena.hpp"
+
+inline void *kF::Core::FrameArenaState::allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    const auto current = _current.load(std::memory_order_acquire);
+
+    if (current) [[likely]] {
+        if (const auto data = TryAllocate(current, bytes, alignment); data) [[likely]]
+            return data;
+    }
+    return allocateSlow(current, bytes, alignment);
+}
+
+inline void *kF::Core::FrameArenaState::TryAllocate(Chunk * const chunk, const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    const auto base = reinterpret_cast<std::uintptr_t>(chunk + 1);
+    auto head = chunk->head.load(std::memory_order_relaxed);
+
+    while (true) {
+        const auto offset = ((base + head + alignment - 1) & ~(alignment - 1)) - base;
+        const auto end = offset + bytes;
+        if (end > chunk->capacity) [[unlikely]]
+            return nullptr;
+        else if (chunk->head.compare_exchange_weak(head, end, std::memory_order_relaxed)) [[likely]]
+            return reinterpret_cast<void *>(base + offset);
+    }
+}
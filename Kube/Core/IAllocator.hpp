@@ -5,7 +5,7 @@
 
 #pragma once
 
-#include "Utils.hpp"
+#include "AllocatorUtils.hpp"
 
 namespace kF::Core
 {
@@ -25,4 +25,14 @@ public:
 
     /** @brief Deallocate memory */
     virtual void deallocate(void * const data, const std::size_t size, const std::size_t alignment) noexcept = 0;
+
+
+    /** @brief Allocate 'count' blocks of the same size and alignment into 'out'
+     *  @return True on success, on failure no allocation is retained */
+    [[nodiscard]] virtual bool allocateBatch(const std::size_t size, const std::size_t alignment, const std::size_t count, void ** const out) noexcept
+        { return AllocatorUtils::FallbackAllocateBatch(*this, size, alignment, count, out); }
+
+    /** @brief Deallocate 'count' blocks of the same size and alignment */
+    virtual void deallocateBatch(const std::size_t size, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept
+        { AllocatorUtils::FallbackDeallocateBatch(*this, size, alignment, count, data); }
 };
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <cstdlib>
+#include <iterator>
 
 #include "Utils.hpp"
 
@@ -70,6 +71,32 @@ public:
     [[nodiscard]] bool pop(Type &value) noexcept;
 
 
+    /** @brief Push exactly 'count' elements into the queue, claiming their cells at once
+     *  @return Success on true */
+    template<std::input_iterator InputIterator>
+    [[nodiscard]] bool tryPushRange(const InputIterator from, const InputIterator to) noexcept
+        { return pushRangeImpl<false>(from, to); }
+
+    /** @brief Push up to 'count' elements into the queue, claiming their cells at once
+     *  @return The number of inserted elements */
+    template<std::input_iterator InputIterator>
+    [[nodiscard]] std::size_t pushRange(const InputIterator from, const InputIterator to) noexcept
+        { return pushRangeImpl<true>(from, to); }
+
+
+    /** @brief Pop exactly 'count' elements from the queue, claiming their cells at once
+     *  @return Success on true */
+    template<typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+    [[nodiscard]] bool tryPopRange(const OutputIterator from, const OutputIterator to) noexcept
+        { return popRangeImpl<false>(from, to); }
+
+    /** @brief Pop up to 'count' elements from the queue, claiming their cells at once
+     *  @return The number of extracted elements */
+    template<typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+    [[nodiscard]] std::size_t popRange(const OutputIterator from, const OutputIterator to) noexcept
+        { return popRangeImpl<true>(from, to); }
+
+
     /** @brief Clear all elements of the queue (unsafe) */
     inline void clear(void) noexcept { for (Type tmp; pop(tmp);); }
 
@@ -84,6 +111,15 @@ private:
     /** @brief Copy and move constructors disabled */
     MPMCQueue(const MPMCQueue &other) = delete;
     MPMCQueue(MPMCQueue &&other) = delete;
+
+
+    /** @brief Implementation of push range */
+    template<bool AllowLess, std::input_iterator InputIterator>
+    [[nodiscard]] std::size_t pushRangeImpl(const InputIterator from, const InputIterator to) noexcept;
+
+    /** @brief Implementation of pop range */
+    template<bool AllowLess, typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+    [[nodiscard]] std::size_t popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept;
 };
 
 static_assert_sizeof(kF::Core::MPMCQueue<int>, 2 * kF::Core::CacheLineDoubleSize);
@@ -90,3 +90,96 @@ inline bool kF::Core::MPMCQueue<Type, Allocator>::pop(Type &value) noexcept
     cell->sequence.store(pos + mask + 1, std::memory_order_release);
     return true;
 }
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<bool AllowLess, std::input_iterator InputIterator>
+inline std::size_t kF::Core::MPMCQueue<Type, Allocator>::pushRangeImpl(const InputIterator from, const InputIterator to) noexcept
+{
+    const auto toPush = static_cast<std::size_t>(std::distance(from, to));
+    auto pos = _tail.load(std::memory_order_relaxed);
+    auto * const data = _tailCache.buffer.data;
+    const auto mask = _tailCache.buffer.mask;
+    std::size_t count;
+
+    while (true) {
+        // Count free cells starting at 'pos'
+        bool outdated = false;
+        for (count = 0; count != toPush; ++count) {
+            const auto expected = pos + count;
+            const auto sequence = data[expected & mask].sequence.load(std::memory_order_acquire);
+            if (sequence != expected) [[unlikely]] {
+                outdated = sequence > expected;
+                break;
+            }
+        }
+        // Another producer claimed a cell, reload tail
+        if (outdated) [[unlikely]] {
+            pos = _tail.load(std::memory_order_relaxed);
+            continue;
+        }
+        // Not enough room
+        if (count != toPush) [[unlikely]] {
+            if constexpr (!AllowLess)
+                return 0;
+            else if (!count)
+                return 0;
+        }
+        // Claim all cells at once
+        if (_tail.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) [[likely]]
+            break;
+    }
+    auto it = from;
+    for (std::size_t i = 0; i != count; ++i, ++it) {
+        auto &cell = data[(pos + i) & mask];
+        new (&cell.data) Type(std::move(*it));
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    return count;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<bool AllowLess, typename OutputIterator> requires std::output_iterator<OutputIterator, Type>
+inline std::size_t kF::Core::MPMCQueue<Type, Allocator>::popRangeImpl(const OutputIterator from, const OutputIterator to) noexcept
+{
+    const auto toPop = static_cast<std::size_t>(to - from);
+    auto pos = _head.load(std::memory_order_relaxed);
+    auto * const data = _headCache.buffer.data;
+    const auto mask = _headCache.buffer.mask;
+    std::size_t count;
+
+    while (true) {
+        // Count published cells starting at 'pos'
+        bool outdated = false;
+        for (count = 0; count != toPop; ++count) {
+            const auto expected = pos + count + 1;
+            const auto sequence = data[(pos + count) & mask].sequence.load(std::memory_order_acquire);
+            if (sequence != expected) [[unlikely]] {
+                outdated = sequence > expected;
+                break;
+            }
+        }
+        // Another consumer claimed a cell, reload head
+        if (outdated) [[unlikely]] {
+            pos = _head.load(std::memory_order_relaxed);
+            continue;
+        }
+        // Not enough elements
+        if (count != toPop) [[unlikely]] {
+            if constexpr (!AllowLess)
+                return 0;
+            else if (!count)
+                return 0;
+        }
+        // Claim all cells at once
+        if (_head.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) [[likely]]
+            break;
+    }
+    auto it = from;
+    for (std::size_t i = 0; i != count; ++i, ++it) {
+        auto &cell = data[(pos + i) & mask];
+        *it = std::move(cell.data);
+        cell.data.~Type();
+        cell.sequence.store(pos + i + mask + 1, std::memory_order_release);
+    }
+    return count;
+}
@@ -3,9 +3,32 @@
  * @ Description: Thread safe allocator
  */
 
+#include <mutex>
+
+#include "Vector.hpp"
 #include "SafeAllocator.hpp"
 
-void kF::Core::AllocatorUtils::DestroySafeAllocator(const std::size_t pageSize, SafeStackMetaData * const stack) noexcept
+using namespace kF;
+
+/** @brief Registry of alive magazine owners */
+struct MagazineRegistry
+{
+    std::mutex mutex {};
+    std::size_t lastId { 0u };
+    Core::Vector<std::size_t> owners {};
+};
+
+/** @brief Get the global magazine registry
+ *  @note The registry is never destroyed as static allocators may unregister after static destruction */
+[[nodiscard]] static MagazineRegistry &GetMagazineRegistry(void) noexcept
+{
+    static MagazineRegistry * const Registry = new MagazineRegistry {};
+
+    return *Registry;
+}
+
+void kF::Core::AllocatorUtils::DestroySafeAllocator(const std::size_t stackAlignment, SafeStackMetaData * const stack,
+        const StackDeallocateFunc deallocateStack) noexcept
 {
     if (!stack) [[unlikely]]
         return;
@@ -25,7 +48,35 @@ void kF::Core::AllocatorUtils::DestroySafeAllocator(const std::size_t pageSize,
     it = prev;
     while (it) {
         auto next = it->next;
-        AllocatorUtils::FallbackDeallocate(it, it->size, pageSize);
+        deallocateStack(it, it->size, stackAlignment);
         it = next;
     }
-}
\ No newline at end of file
+}
+
+std::size_t kF::Core::AllocatorUtils::RegisterMagazineOwner(void) noexcept
+{
+    auto &registry = GetMagazineRegistry();
+    std::lock_guard lock(registry.mutex);
+
+    const auto id = ++registry.lastId;
+    registry.owners.push(id);
+    return id;
+}
+
+void kF::Core::AllocatorUtils::UnregisterMagazineOwner(const std::size_t ownerId) noexcept
+{
+    auto &registry = GetMagazineRegistry();
+    std::lock_guard lock(registry.mutex);
+
+    if (const auto it = registry.owners.find(ownerId); it != registry.owners.end()) [[likely]]
+        registry.owners.erase(it);
+}
+
+void kF::Core::AllocatorUtils::FlushMagazineOwner(const std::size_t ownerId, const MagazineFlushCallback callback, void * const userData) noexcept
+{
+    auto &registry = GetMagazineRegistry();
+    std::lock_guard lock(registry.mutex);
+
+    if (registry.owners.find(ownerId) != registry.owners.end()) [[likely]]
+        callback(userData);
+}
@@ -11,10 +11,13 @@
 #include "TaggedPtr.hpp"
 #include "IAllocator.hpp"
 #include "AllocatorUtils.hpp"
+#include "AllocatorStats.hpp"
+#include "StackProvider.hpp"
 
 namespace kF::Core
 {
-    template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSize>
+    template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSize, std::size_t MagazineDepth,
+            kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
     class SafeAllocator;
 
     namespace AllocatorUtils
@@ -25,6 +28,7 @@ namespace kF::Core
             std::size_t size { 0u };
             std::size_t head { 0u };
             SafeStackMetaData *next {};
+            std::size_t owner { 0u }; // Remote free owner slot + 1 (0 if not owned)
 
             /** @brief Get the stack data pointer at given byte index */
             [[nodiscard]] inline void *dataHead(void) noexcept
@@ -78,8 +82,67 @@ namespace kF::Core
         template<std::size_t Alignment>
         void InsertAtomicBucket(AtomicBucket<Alignment> &bucket, void * const data) noexcept;
 
+        /** @brief Try to steal a chain of up to 'count' allocations from an atomic bucket with a single CAS
+         *  @return The head of the null terminated chain, 'stolen' receives its size */
+        template<std::size_t Alignment>
+        [[nodiscard]] AllocationHeader *TryStealAtomicBucketChain(AtomicBucket<Alignment> &bucket, const std::size_t count, std::size_t &stolen) noexcept;
+
+        /** @brief Insert a chain of allocations into a bucket list with a single CAS */
+        template<std::size_t Alignment>
+        void InsertAtomicBucketChain(AtomicBucket<Alignment> &bucket, AllocationHeader * const head, AllocationHeader * const tail) noexcept;
+
+        /** @brief Stack deallocation function */
+        using StackDeallocateFunc = void(*)(void * const data, const std::size_t size, const std::size_t alignment) noexcept;
+
         /** @brief Non-template utility that destroys safe allocator stacks */
-        void DestroySafeAllocator(const std::size_t pageSize, SafeStackMetaData * const stack) noexcept;
+        void DestroySafeAllocator(const std::size_t stackAlignment, SafeStackMetaData * const stack, const StackDeallocateFunc deallocateStack) noexcept;
+
+
+        /** @brief Thread local magazine of a single bucket */
+        struct SafeMagazine
+        {
+            AllocationHeader *head {};
+            std::size_t count { 0u };
+
+            /** @brief Pop an allocation from the magazine, the magazine must not be empty */
+            [[nodiscard]] inline void *pop(void) noexcept
+                { const auto data = head; head = data->next; --count; return data; }
+
+            /** @brief Push an allocation into the magazine */
+            inline void push(void * const data) noexcept
+                { const auto ptr = reinterpret_cast<AllocationHeader *>(data); ptr->next = head; head = ptr; ++count; }
+        };
+
+        /** @brief Placeholder of disabled allocator features */
+        struct Empty {};
+
+        /** @brief Remote free lists of a single owner thread (one MPSC list per bucket) */
+        template<std::size_t BucketCount>
+        struct alignas_cacheline SafeRemoteOwner
+        {
+            std::atomic<bool> used { false };
+            std::array<std::atomic<AllocationHeader *>, BucketCount> lists {};
+        };
+
+        /** @brief Push an allocation into a remote free list (multiple producers) */
+        inline void PushRemoteFree(std::atomic<AllocationHeader *> &list, void * const data) noexcept;
+
+        /** @brief Get the last allocation of a chain and its size, 'head' must not be null */
+        [[nodiscard]] inline AllocationHeader *GetAllocationChainTail(AllocationHeader * const head, std::size_t &count) noexcept;
+
+
+        /** @brief Flush callback of a magazine owner */
+        using MagazineFlushCallback = void(*)(void * const userData) noexcept;
+
+        /** @brief Register a new magazine owner and return its unique identifier */
+        [[nodiscard]] std::size_t RegisterMagazineOwner(void) noexcept;
+
+        /** @brief Unregister a magazine owner, once this function returns no flush can target the owner anymore */
+        void UnregisterMagazineOwner(const std::size_t ownerId) noexcept;
+
+        /** @brief Invoke a flush callback only if the magazine owner is still alive
+         *  @note The callback is invoked under the registry lock so that the owner cannot be destroyed meanwhile */
+        void FlushMagazineOwner(const std::size_t ownerId, const MagazineFlushCallback callback, void * const userData) noexcept;
     }
 
 }
@@ -101,12 +164,25 @@ namespace kF::Core
  *  @tparam MinSizePower The minimal allocation size a bucket can store
  *  @tparam MaxSizePower The maximal allocation size a bucket can store
  *  @tparam MaxStackSizePower The maximal allocation size a stack can have
+ *  @tparam MagazineDepth The maximal count of allocations each thread can retain per bucket (0 disables magazines)
+ *  @tparam StackProvider The provider used to reserve and release stacks (see VirtualStackProvider for huge pages support)
+ *  @tparam RemoteFree If true, each stack is owned by the thread that built it and cross-thread deallocations go to its owner remote free list
+ *
+ *  When MagazineDepth is not null, each thread owns a magazine per bucket that serves allocations without any CAS.
+ *  An empty magazine is refilled by batch from its global bucket and a full magazine flushes half of its allocations back.
+ *  Magazines are shared by all instances of the same allocator type within a thread, switching instance flushes them.
+ *
+ *  When RemoteFree is set (requires magazines), stacks are aligned over MaxStackSize so that the owner of any allocation is found in O(1).
+ *  An allocation freed by another thread than its owner is pushed into a per-owner MPSC list, instead of the shared buckets.
+ *  The owner drains its remote list lazily, when its magazine is empty. At most RemoteOwnerCount threads own stacks at a time,
+ *  the others fall back to shared buckets.
  *
  *  @todo Benchmark an allocate implementation that prioritize stack allocation rather than fragmentation in case of non perfect fit
  *
  *  @note 1 << 16 == MMAP_THRESHOLD
 */
-template<std::size_t MinSizePower = 5, std::size_t MaxSizePower = 12, std::size_t MaxStackSizePower = 16>
+template<std::size_t MinSizePower = 5, std::size_t MaxSizePower = 12, std::size_t MaxStackSizePower = 16, std::size_t MagazineDepth = 0,
+        kF::Core::StackProviderRequirements StackProvider = kF::Core::DefaultStackProvider, bool RemoteFree = false>
 class alignas_double_cacheline kF::Core::SafeAllocator : public IAllocator
 {
 public:
@@ -122,10 +198,23 @@ public:
     /** @brief Maximum stack allocation size in byte */
     static constexpr std::size_t MaxStackSize = 1ul << MaxStackSizePower;
 
+    /** @brief True if thread local magazines are enabled */
+    static constexpr bool HasMagazines = MagazineDepth != 0;
+
+    /** @brief Number of allocations transfered at once between a magazine and its global bucket */
+    static constexpr std::size_t MagazineBatchSize = (MagazineDepth + 1) / 2;
+
+    /** @brief True if remote free lists are enabled */
+    static constexpr bool HasRemoteFree = RemoteFree;
+
+    /** @brief Maximum number of threads owning stacks at the same time */
+    static constexpr std::size_t RemoteOwnerCount = RemoteFree ? 64 : 0;
+
 
     static_assert(MaxStackSize > MaxSize);
     static_assert(BucketCount > 0, "BucketCount must be superior to 0");
     static_assert(MinSize >= sizeof(void *), "MinSize must be superior or equal to sizeof(void *)");
+    static_assert(!RemoteFree || HasMagazines, "RemoteFree requires a non null MagazineDepth");
 
 
     /** @brief Virtual destructor ! NOT THREAD SAFE ! */
@@ -142,11 +231,82 @@ public:
     void deallocate(void * const data, const std::size_t size, const std::size_t alignment) noexcept override;
 
 
+    /** @brief Batch allocate function implementation, pops a whole chain from a bucket at once */
+    [[nodiscard]] bool allocateBatch(const std::size_t size, const std::size_t alignment, const std::size_t count, void ** const out) noexcept override;
+
+    /** @brief Batch deallocate function implementation, pushes a whole chain into a bucket at once */
+    void deallocateBatch(const std::size_t size, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept override;
+
+
     /** @brief Check if the allocator still has allocations
      *  @note This function is slow */
     [[nodiscard]] bool empty(void) noexcept;
 
+
+    /** @brief Get a snapshot of allocator statistics
+     *  @note Statistics are empty unless KUBE_ALLOCATOR_STATS is enabled */
+    inline void stats(AllocatorStats &out) const noexcept { _stats.snapshot(out); }
+
+
+    /** @brief Give back every allocation retained by the magazines of the calling thread to the global buckets */
+    void flushThreadCache(void) noexcept;
+
 private:
+    /** @brief Remote free lists of every owner slot */
+    using RemoteOwners = std::conditional_t<RemoteFree,
+        std::array<AllocatorUtils::SafeRemoteOwner<BucketCount>, RemoteOwnerCount>,
+        AllocatorUtils::Empty
+    >;
+
+    /** @brief Per-thread cache of magazines */
+    struct ThreadCache
+    {
+        SafeAllocator *owner {};
+        std::size_t ownerId { 0u };
+        std::size_t remoteSlot { 0u }; // Remote free owner slot + 1 (0 if not owned)
+        std::array<AllocatorUtils::SafeMagazine, BucketCount> magazines {};
+
+        /** @brief Destructor, give back magazines to their owner */
+        inline ~ThreadCache(void) noexcept { release(); }
+
+        /** @brief Give back magazines to their owner if still alive, then reset the cache */
+        void release(void) noexcept;
+    };
+
+    /** @brief Get the calling thread cache */
+    [[nodiscard]] static ThreadCache &GetThreadCache(void) noexcept;
+
+    /** @brief Get the calling thread cache, bound to this instance */
+    [[nodiscard]] ThreadCache &acquireThreadCache(void) noexcept;
+
+    /** @brief Refill an empty magazine from its global bucket and return an allocation */
+    [[nodiscard]] void *refillMagazine(AllocatorUtils::SafeMagazine &magazine, const std::size_t bucketIndex) noexcept;
+
+    /** @brief Flush up to 'count' allocations of a magazine into its global bucket */
+    void flushMagazine(AllocatorUtils::SafeMagazine &magazine, const std::size_t bucketIndex, const std::size_t count) noexcept;
+
+
+    /** @brief Acquire a free remote owner slot, returns 0 if none is available */
+    [[nodiscard]] std::size_t acquireRemoteSlot(void) noexcept;
+
+    /** @brief Drain a remote owner slot into global buckets then release it */
+    void releaseRemoteSlot(const std::size_t remoteSlot) noexcept;
+
+    /** @brief Drain every remote free list of an owner slot into global buckets */
+    void flushRemoteSlot(const std::size_t remoteSlot) noexcept;
+
+    /** @brief Drain the remote free list of a bucket into a magazine, returns false if the list was empty */
+    [[nodiscard]] bool drainRemoteFree(ThreadCache &cache, const std::size_t bucketIndex) noexcept;
+
+    /** @brief Get the stack owning an allocation */
+    [[nodiscard]] static inline AllocatorUtils::SafeStackMetaData *GetOwningStack(void * const data) noexcept
+        { return reinterpret_cast<AllocatorUtils::SafeStackMetaData *>(reinterpret_cast<std::uintptr_t>(data) & ~(MaxStackSize - 1)); }
+
+    /** @brief Get the alignment of stacks */
+    [[nodiscard]] inline std::size_t stackAlignment(void) const noexcept
+        { return RemoteFree ? MaxStackSize : _pageSize; }
+
+
     /** @brief Allocate data from a specific bucket */
     [[nodiscard]] void *allocateFromBucket(const std::size_t bucketIndex) noexcept;
 
@@ -171,6 +331,7 @@ private:
 
     // Cacheline 0
     alignas_cacheline const std::size_t _pageSize;
+    const std::size_t _magazineId { 0u };
     // Cacheline 1
     alignas_cacheline std::atomic<std::size_t> _maxStackSize { 0u };
     // Cacheline 2
@@ -179,6 +340,10 @@ private:
     alignas_cacheline AllocatorUtils::AtomicStack _busyStack {};
     // Cacheline 4 + (1 per bucket)
     std::array<AllocatorUtils::AlignedAtomicBucket<MinSize>, BucketCount> _buckets {};
+    // Remote free lists (empty unless enabled)
+    [[no_unique_address]] RemoteOwners _remoteOwners {};
+    // Statistics (empty unless enabled)
+    [[no_unique_address]] AllocatorUtils::StatsCounters<MinSizePower, BucketCount, true> _stats {};
 };
 
 #include "SafeAllocator.ipp"
\ No newline at end of file
@@ -35,6 +35,30 @@ inline void kF::Core::AllocatorUtils::InsertAtomicStack(AtomicStack &target, Saf
     }
 }
 
+inline void kF::Core::AllocatorUtils::PushRemoteFree(std::atomic<AllocationHeader *> &list, void * const data) noexcept
+{
+    auto ptr = reinterpret_cast<AllocationHeader *>(data);
+    auto head = list.load(std::memory_order_relaxed);
+
+    // Lists are only consumed at once by exchange, thus no ABA can occur
+    do {
+        ptr->next = head;
+    } while (!list.compare_exchange_weak(head, ptr, std::memory_order_release, std::memory_order_relaxed));
+}
+
+inline kF::Core::AllocatorUtils::AllocationHeader *kF::Core::AllocatorUtils::GetAllocationChainTail(
+        AllocationHeader * const head, std::size_t &count) noexcept
+{
+    auto tail = head;
+
+    count = 1u;
+    while (tail->next) {
+        tail = tail->next;
+        ++count;
+    }
+    return tail;
+}
+
 template<std::size_t Alignment>
 inline void *kF::Core::AllocatorUtils::TryStealAtomicBucket(AtomicBucket<Alignment> &bucket) noexcept
 {
@@ -66,9 +90,61 @@ inline void kF::Core::AllocatorUtils::InsertAtomicBucket(AtomicBucket<Alignment>
     }
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::~SafeAllocator(void) noexcept
+template<std::size_t Alignment>
+inline kF::Core::AllocatorUtils::AllocationHeader *kF::Core::AllocatorUtils::TryStealAtomicBucketChain(
+        AtomicBucket<Alignment> &bucket, const std::size_t count, std::size_t &stolen) noexcept
+{
+    auto allocation = bucket.load(std::memory_order_acquire);
+    AllocationHeader *tail {};
+    std::size_t size {};
+
+    while (true) {
+        if (!allocation) [[unlikely]]
+            break;
+        // Walk the chain, ensuring the bucket did not change before following each link
+        tail = allocation.get();
+        size = 1u;
+        while (size != count) {
+            const auto next = tail->next;
+            if (bucket.load(std::memory_order_acquire) != allocation) [[unlikely]]
+                break;
+            else if (!next)
+                break;
+            tail = next;
+            ++size;
+        }
+        decltype(allocation) next(tail->next, allocation.tag() + 1);
+        if (bucket.compare_exchange_weak(allocation, next, std::memory_order_acq_rel))
+            break;
+    }
+    if (allocation) [[likely]] {
+        tail->next = nullptr;
+        stolen = size;
+    } else
+        stolen = 0u;
+    return allocation.get();
+}
+
+template<std::size_t Alignment>
+inline void kF::Core::AllocatorUtils::InsertAtomicBucketChain(
+        AtomicBucket<Alignment> &bucket, AllocationHeader * const head, AllocationHeader * const tail) noexcept
+{
+    auto allocation = bucket.load(std::memory_order_acquire);
+
+    while (true) {
+        tail->next = allocation.get();
+        decltype(allocation) next(head, allocation.tag() + 1);
+        if (bucket.compare_exchange_weak(allocation, next, std::memory_order_acq_rel))
+            break;
+    }
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::~SafeAllocator(void) noexcept
 {
+    if constexpr (HasMagazines)
+        AllocatorUtils::UnregisterMagazineOwner(_magazineId);
+
     while (true) {
         auto stack = AllocatorUtils::TryStealAtomicStack(_stack);
         if (stack)
@@ -77,52 +153,143 @@ inline kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::~
             break;
     }
 
-    AllocatorUtils::DestroySafeAllocator(_pageSize, _busyStack.load().get());
+    AllocatorUtils::DestroySafeAllocator(stackAlignment(), _busyStack.load().get(), &StackProvider::DeallocateStack);
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::SafeAllocator(void) noexcept
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::SafeAllocator(void) noexcept
     : _pageSize(Platform::GetPageSize())
+    , _magazineId(HasMagazines ? AllocatorUtils::RegisterMagazineOwner() : 0u)
 {
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline void *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::allocate(const std::size_t size, const std::size_t alignment) noexcept
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::allocate(const std::size_t size, const std::size_t alignment) noexcept
 {
     void *data = nullptr;
 
     // If the size fits into the maximum size a bucket can hold, look for existing buckets
     if (const auto targetSize = std::max(size, alignment); targetSize <= MaxSize) [[likely]] {
         // Find perfect bucket fit index
-        data = allocateFromBucket(AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize));
+        const auto bucketIndex = AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize);
+        data = allocateFromBucket(bucketIndex);
+        _stats.onAllocate(bucketIndex, 1u);
     // The required size is out of buckets retention range
     } else [[unlikely]] {
         data = AllocatorUtils::FallbackAllocate(size, alignment);
+        _stats.onFallbackAllocate(size);
     }
 
     return data;
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::deallocate(
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::deallocate(
         void * const data, const std::size_t size, const std::size_t alignment) noexcept
 {
     auto targetSize = std::max(size, alignment);
     // If the size is retainable, insert it into a bucket
     if (data && targetSize <= MaxSize) [[likely]] {
-        deallocateFromBucket(data, AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize));
+        const auto bucketIndex = AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize);
+        deallocateFromBucket(data, bucketIndex);
+        _stats.onDeallocate(bucketIndex, 1u);
     // Else deallocate it
     } else [[unlikely]] {
+        if (data)
+            _stats.onFallbackDeallocate(size);
         AllocatorUtils::FallbackDeallocate(data, size, alignment);
     }
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline void *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::allocateFromBucket(
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline bool kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::allocateBatch(
+        const std::size_t size, const std::size_t alignment, const std::size_t count, void ** const out) noexcept
+{
+    const auto targetSize = std::max(size, alignment);
+
+    // The required size is out of buckets retention range
+    if (targetSize > MaxSize) [[unlikely]]
+        return AllocatorUtils::FallbackAllocateBatch(*this, size, alignment, count, out);
+
+    const auto bucketIndex = AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize);
+    std::size_t index = 0u;
+
+    // Drain thread local magazine first
+    if constexpr (HasMagazines) {
+        auto &magazine = acquireThreadCache().magazines[bucketIndex];
+        while (index != count && magazine.head)
+            out[index++] = magazine.pop();
+    }
+
+    // Steal a whole chain from the global bucket
+    if (index != count) {
+        std::size_t stolen {};
+        auto it = AllocatorUtils::TryStealAtomicBucketChain(_buckets[bucketIndex].value, count - index, stolen);
+        for (; it; it = it->next)
+            out[index++] = it;
+    }
+
+    // Allocate what is left from stacks
+    const auto bucketSize = static_cast<std::size_t>(1u) << (bucketIndex + MinSizePower);
+    for (; index != count; ++index) {
+        out[index] = allocateFromStack(bucketSize);
+        if (!out[index]) [[unlikely]] {
+            _stats.onAllocate(bucketIndex, index);
+            deallocateBatch(size, alignment, index, out);
+            return false;
+        }
+    }
+    _stats.onAllocate(bucketIndex, count);
+    return true;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::deallocateBatch(
+        const std::size_t size, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept
+{
+    const auto targetSize = std::max(size, alignment);
+
+    // The size is out of buckets retention range
+    if (targetSize > MaxSize) [[unlikely]]
+        return AllocatorUtils::FallbackDeallocateBatch(*this, size, alignment, count, data);
+
+    const auto bucketIndex = AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize);
+    std::size_t index = 0u;
+
+    _stats.onDeallocate(bucketIndex, count);
+
+    // Fill thread local magazine first
+    if constexpr (HasMagazines) {
+        auto &magazine = acquireThreadCache().magazines[bucketIndex];
+        while (index != count && magazine.count != MagazineDepth)
+            magazine.push(data[index++]);
+    }
+
+    // Push what is left as a single chain
+    if (index != count) {
+        const auto tail = AllocatorUtils::LinkAllocationChain(data + index, count - index);
+        AllocatorUtils::InsertAtomicBucketChain(
+            _buckets[bucketIndex].value,
+            reinterpret_cast<AllocatorUtils::AllocationHeader *>(data[index]),
+            tail
+        );
+    }
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::allocateFromBucket(
         const std::size_t bucketIndex) noexcept
 {
     void *data = nullptr;
 
+    // Try thread local magazine without any synchronization
+    if constexpr (HasMagazines) {
+        auto &magazine = acquireThreadCache().magazines[bucketIndex];
+        if (magazine.head) [[likely]]
+            return magazine.pop();
+        return refillMagazine(magazine, bucketIndex);
+    }
+
     // Try perfect bucket fit if possible
     data = AllocatorUtils::TryStealAtomicBucket(_buckets[bucketIndex].value);
     // Else, allocate from a stack
@@ -131,15 +298,30 @@ inline void *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePow
     return data;
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::deallocateFromBucket(
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::deallocateFromBucket(
         void * const data, const std::size_t bucketIndex) noexcept
 {
-    AllocatorUtils::InsertAtomicBucket(_buckets[bucketIndex].value, data);
+    // Retain data into thread local magazine, flushing half of it when full
+    if constexpr (HasMagazines) {
+        auto &cache = acquireThreadCache();
+        // Give back data to its owner if it belongs to another thread
+        if constexpr (HasRemoteFree) {
+            if (const auto owner = GetOwningStack(data)->owner; owner && owner != cache.remoteSlot) {
+                AllocatorUtils::PushRemoteFree(_remoteOwners[owner - 1].lists[bucketIndex], data);
+                return;
+            }
+        }
+        auto &magazine = cache.magazines[bucketIndex];
+        if (magazine.count == MagazineDepth) [[unlikely]]
+            flushMagazine(magazine, bucketIndex, MagazineBatchSize);
+        magazine.push(data);
+    } else
+        AllocatorUtils::InsertAtomicBucket(_buckets[bucketIndex].value, data);
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline void *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::allocateFromStack(
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::allocateFromStack(
     const std::size_t bucketSize) noexcept
 {
     void *data {};
@@ -184,24 +366,32 @@ inline void *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePow
     return data;
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline kF::Core::AllocatorUtils::SafeStackMetaData *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::buildStack(
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline kF::Core::AllocatorUtils::SafeStackMetaData *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::buildStack(
         const std::size_t bucketSize) noexcept
 {
     auto maxStackSize = _maxStackSize.load(std::memory_order_acquire);
-    auto stackSize = AllocatorUtils::GetStackSize<sizeof(AllocatorUtils::SafeStackMetaData), MaxStackSize>(
+    // Remote free requires every stack to be aligned over MaxStackSize to find allocations owner
+    auto stackSize = RemoteFree ? MaxStackSize : AllocatorUtils::GetStackSize<sizeof(AllocatorUtils::SafeStackMetaData), MaxStackSize>(
         bucketSize,
         _pageSize,
         maxStackSize
     );
-    const auto data = AllocatorUtils::FallbackAllocate(stackSize, _pageSize);
+    const auto data = StackProvider::AllocateStack(stackSize, stackAlignment());
     AllocatorUtils::SafeStackMetaData *stack {};
     if (data) [[likely]] {
+        _stats.onStack(stackSize);
         stack = new (data) AllocatorUtils::SafeStackMetaData {
             .size = stackSize,
             .head = sizeof(AllocatorUtils::SafeStackMetaData),
-            .next = nullptr
+            .next = nullptr,
+            .owner = 0u
         };
+        // The thread building the stack becomes its owner
+        if constexpr (HasRemoteFree) {
+            if (const auto &cache = GetThreadCache(); cache.ownerId == _magazineId)
+                stack->owner = cache.remoteSlot;
+        }
     }
 
     // Set max stack size if higher than previous
@@ -210,19 +400,20 @@ inline kF::Core::AllocatorUtils::SafeStackMetaData *kF::Core::SafeAllocator<MinS
     return stack;
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::fragmentStack(
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::fragmentStack(
         AllocatorUtils::SafeStackMetaData * const stack) noexcept
 {
     // Fragment all available stack size
+    _stats.onFragmentation();
     fragmentStackBlock(stack, stack->size - stack->head);
 
     // Insert the stack in busy list
     AllocatorUtils::InsertAtomicStack(_busyStack, stack);
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::fragmentStackBlock(
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::fragmentStackBlock(
         AllocatorUtils::SafeStackMetaData * const stack, const std::size_t size) noexcept
 {
     auto availableSize = size;
@@ -237,8 +428,10 @@ inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePowe
         const auto blockPower = AllocatorUtils::FindBucketFit<MaxSizePower>(availableSize, head);
 
         // If this block is retainable, insert it into a bucket
-        if (blockPower >= MinSizePower) [[likely]]
+        if (blockPower >= MinSizePower) [[likely]] {
             AllocatorUtils::InsertAtomicBucket(_buckets[blockPower - MinSizePower].value, stack->dataAt(head));
+            _stats.onFragmentedBlock(blockPower - MinSizePower);
+        }
 
         // Reduce available size by fragmented block size
         const auto blockSize = static_cast<std::size_t>(1u) << blockPower;
@@ -247,12 +440,190 @@ inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePowe
     }
 }
 
-template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
-inline bool kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::empty(void) noexcept
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline bool kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::empty(void) noexcept
 {
+    if constexpr (HasMagazines)
+        flushThreadCache();
     for (const auto &bucket : _buckets) {
         if (bucket.value.load(std::memory_order_acquire))
             return false;
     }
     return true;
 }
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::flushThreadCache(void) noexcept
+{
+    if constexpr (HasMagazines) {
+        auto &cache = GetThreadCache();
+        if (cache.ownerId != _magazineId)
+            return;
+        for (auto bucketIndex = 0ul; bucketIndex != BucketCount; ++bucketIndex)
+            flushMagazine(cache.magazines[bucketIndex], bucketIndex, MagazineDepth);
+        if constexpr (HasRemoteFree) {
+            if (cache.remoteSlot)
+                flushRemoteSlot(cache.remoteSlot);
+        }
+    }
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::ThreadCache::release(void) noexcept
+{
+    if (ownerId) {
+        // Magazines of a destroyed owner point to released stacks and are simply dropped
+        AllocatorUtils::FlushMagazineOwner(ownerId, [](void * const userData) noexcept {
+            auto &cache = *reinterpret_cast<ThreadCache *>(userData);
+            for (auto bucketIndex = 0ul; bucketIndex != BucketCount; ++bucketIndex)
+                cache.owner->flushMagazine(cache.magazines[bucketIndex], bucketIndex, MagazineDepth);
+            if constexpr (HasRemoteFree) {
+                if (cache.remoteSlot)
+                    cache.owner->releaseRemoteSlot(cache.remoteSlot);
+            }
+        }, this);
+    }
+    owner = nullptr;
+    ownerId = 0u;
+    remoteSlot = 0u;
+    magazines = {};
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline typename kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::ThreadCache &kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::GetThreadCache(void) noexcept
+{
+    static thread_local ThreadCache Cache {};
+
+    return Cache;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline typename kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::ThreadCache &kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::acquireThreadCache(void) noexcept
+{
+    auto &cache = GetThreadCache();
+
+    // Rebind the cache if it belongs to another instance
+    if (cache.ownerId != _magazineId) [[unlikely]] {
+        cache.release();
+        cache.owner = this;
+        cache.ownerId = _magazineId;
+        if constexpr (HasRemoteFree)
+            cache.remoteSlot = acquireRemoteSlot();
+    }
+    return cache;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void *kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::refillMagazine(
+        AllocatorUtils::SafeMagazine &magazine, const std::size_t bucketIndex) noexcept
+{
+    // Drain allocations given back by other threads
+    if constexpr (HasRemoteFree) {
+        if (drainRemoteFree(GetThreadCache(), bucketIndex))
+            return magazine.pop();
+    }
+
+    // Steal a batch of allocations from the global bucket
+    std::size_t stolen {};
+    magazine.head = AllocatorUtils::TryStealAtomicBucketChain(_buckets[bucketIndex].value, MagazineBatchSize, stolen);
+    magazine.count = stolen;
+
+    // Fallback to stack allocation if the global bucket was empty
+    if (magazine.head) [[likely]]
+        return magazine.pop();
+    return allocateFromStack(static_cast<std::size_t>(1u) << (bucketIndex + MinSizePower));
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::flushMagazine(
+        AllocatorUtils::SafeMagazine &magazine, const std::size_t bucketIndex, const std::size_t count) noexcept
+{
+    if (!magazine.head || !count) [[unlikely]]
+        return;
+
+    // Detach a chain of up to 'count' allocations
+    const auto head = magazine.head;
+    auto tail = head;
+    std::size_t size = 1u;
+    while (size != count && tail->next) {
+        tail = tail->next;
+        ++size;
+    }
+    magazine.head = tail->next;
+    magazine.count -= size;
+
+    // Insert the whole chain at once
+    AllocatorUtils::InsertAtomicBucketChain(_buckets[bucketIndex].value, head, tail);
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline std::size_t kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::acquireRemoteSlot(void) noexcept
+{
+    if constexpr (HasRemoteFree) {
+        for (std::size_t index = 0u; index != RemoteOwnerCount; ++index) {
+            auto &owner = _remoteOwners[index];
+            bool expected = false;
+            if (!owner.used.load(std::memory_order_relaxed) && owner.used.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return index + 1;
+        }
+    }
+    return 0u;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::releaseRemoteSlot(const std::size_t remoteSlot) noexcept
+{
+    if constexpr (HasRemoteFree) {
+        // Allocations freed after this flush stay in the lists until another thread acquires the slot
+        flushRemoteSlot(remoteSlot);
+        _remoteOwners[remoteSlot - 1].used.store(false, std::memory_order_release);
+    }
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline void kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::flushRemoteSlot(const std::size_t remoteSlot) noexcept
+{
+    if constexpr (HasRemoteFree) {
+        auto &owner = _remoteOwners[remoteSlot - 1];
+        for (auto bucketIndex = 0ul; bucketIndex != BucketCount; ++bucketIndex) {
+            if (const auto head = owner.lists[bucketIndex].exchange(nullptr, std::memory_order_acquire); head) {
+                std::size_t count {};
+                const auto tail = AllocatorUtils::GetAllocationChainTail(head, count);
+                AllocatorUtils::InsertAtomicBucketChain(_buckets[bucketIndex].value, head, tail);
+            }
+        }
+    }
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t MagazineDepth, kF::Core::StackProviderRequirements StackProvider, bool RemoteFree>
+inline bool kF::Core::SafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, MagazineDepth, StackProvider, RemoteFree>::drainRemoteFree(ThreadCache &cache, const std::size_t bucketIndex) noexcept
+{
+    if constexpr (HasRemoteFree) {
+        if (!cache.remoteSlot) [[unlikely]]
+            return false;
+        const auto head = _remoteOwners[cache.remoteSlot - 1].lists[bucketIndex].exchange(nullptr, std::memory_order_acquire);
+        if (!head)
+            return false;
+
+        // Keep up to MagazineDepth allocations in the magazine (which is empty)
+        auto &magazine = cache.magazines[bucketIndex];
+        auto tail = head;
+        std::size_t count = 1u;
+        while (count != MagazineDepth && tail->next) {
+            tail = tail->next;
+            ++count;
+        }
+        const auto rest = tail->next;
+        tail->next = nullptr;
+        magazine.head = head;
+        magazine.count = count;
+
+        // Give back the rest to the global bucket
+        if (rest) [[unlikely]] {
+            const auto restTail = AllocatorUtils::GetAllocationChainTail(rest, count);
+            AllocatorUtils::InsertAtomicBucketChain(_buckets[bucketIndex].value, rest, restTail);
+        }
+        return true;
+    } else
+        return false;
+}
@@ -0,0 +1,109 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Segmented MPSC Queue
+ */
+
+#pragma once
+
+#include <atomic>
+#include <array>
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, std::size_t MaxFreeSegmentCount>
+    class SegmentedMPSCQueue;
+}
+
+/**
+ * @brief The segmented MPSC queue is an unbounded lock-free queue that supports Multiple Producers and a Single Consumer
+ * Elements are stored in a linked list of fixed size segments, producers never fail to push
+ * Consumed segments are recycled through a bounded free list, surplus segments are returned to the allocator
+ * once no producer is pushing anymore (a late producer may still reference a consumed segment)
+ *
+ * @tparam Type to be inserted
+ * @tparam Allocator Static allocator
+ * @tparam SegmentCapacity Number of elements per segment
+ * @tparam MaxFreeSegmentCount Maximum number of segments kept for recycling
+ */
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, std::size_t SegmentCapacity = 64, std::size_t MaxFreeSegmentCount = 4>
+class alignas_double_cacheline kF::Core::SegmentedMPSCQueue
+{
+public:
+    static_assert(SegmentCapacity >= 2, "Core::SegmentedMPSCQueue: SegmentCapacity must be at least 2");
+
+    /** @brief Each cell stores an element and its publication state */
+    struct Cell
+    {
+        std::atomic<bool> ready {};
+        alignas(Type) std::byte data[sizeof(Type)];
+    };
+
+    /** @brief A segment of the queue */
+    struct alignas_cacheline Segment
+    {
+        // Cacheline 0
+        std::atomic<std::size_t> reserve { SegmentCapacity + 1 }; // Number of reservations, closed until the segment is linked
+                                                                   // The producer reserving exactly 'SegmentCapacity' links the next segment
+        // Cacheline 1
+        alignas_cacheline std::atomic<Segment *> next {};
+        Segment *nextFree {};
+        // Cacheline 2 -> N
+        alignas_cacheline std::array<Cell, SegmentCapacity> cells {};
+    };
+
+
+    /** @brief Destruct and release all memory (unsafe) */
+    ~SegmentedMPSCQueue(void) noexcept;
+
+    /** @brief Default constructor initialize the queue with a single segment */
+    SegmentedMPSCQueue(void) noexcept;
+
+
+    /** @brief Push a single element into the queue
+     *  @tparam Set MoveOnSuccess to true to move 'args' instead of forward on push success
+     *  @return Always true, kept for compatibility with bounded queues */
+    template<bool MoveOnSuccess = false, typename ...Args>
+    bool push(Args &&...args) noexcept;
+
+
+    /** @brief Pop a single element from the queue
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool pop(Type &value) noexcept;
+
+
+    /** @brief Clear all elements of the queue (unsafe) */
+    inline void clear(void) noexcept { for (Type tmp; pop(tmp);); }
+
+
+private:
+    /** @brief Get a segment from the free list or allocate a new one */
+    [[nodiscard]] Segment *acquireSegment(void) noexcept;
+
+    /** @brief Give back a consumed segment to the free list, or retire it if the free list is full */
+    void releaseSegment(Segment * const segment) noexcept;
+
+    /** @brief Return retired segments to the allocator if no producer may still reference them */
+    void releaseRetiredSegments(void) noexcept;
+
+    /** @brief Link a new segment after a full one, only called by the producer which reserved the last index + 1 */
+    void linkSegment(Segment * const segment) noexcept;
+
+    alignas_cacheline std::atomic<Segment *> _tail {}; // Tail segment accessed by producers
+    std::atomic<std::size_t> _pushCount {}; // Number of producers currently pushing
+    alignas_cacheline std::atomic<Segment *> _freeList {}; // Free segments pushed by the consumer and poped by the producer linking a segment
+    std::atomic<std::size_t> _freeCount {}; // Approximate number of segments in the free list
+    alignas_cacheline Segment *_head {}; // Head segment accessed by the consumer
+    std::size_t _headIndex {};
+    Segment *_retired {}; // Surplus segments waiting to be returned to the allocator (consumer only)
+
+
+    /** @brief Copy and move disabled */
+    SegmentedMPSCQueue(const SegmentedMPSCQueue &other) = delete;
+    SegmentedMPSCQueue(SegmentedMPSCQueue &&other) = delete;
+    SegmentedMPSCQueue &operator=(const SegmentedMPSCQueue &other) = delete;
+    SegmentedMPSCQueue &operator=(SegmentedMPSCQueue &&other) = delete;
+};
+
+#include "SegmentedMPSCQueue.ipp"
@@ -0,0 +1,159 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Segmented MPSC Queue
+ */
+
+#include "Abort.hpp"
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, std::size_t MaxFreeSegmentCount>
+inline kF::Core::SegmentedMPSCQueue<Type, Allocator, SegmentCapacity, MaxFreeSegmentCount>::~SegmentedMPSCQueue(void) noexcept
+{
+    clear();
+    // Release linked segments then free and retired segments
+    for (auto segment = _head; segment;) {
+        const auto next = segment->next.load(std::memory_order_relaxed);
+        segment->~Segment();
+        Allocator::Deallocate(segment, sizeof(Segment), alignof(Segment));
+        segment = next;
+    }
+    for (auto list : { _freeList.load(std::memory_order_relaxed), _retired }) {
+        for (auto segment = list; segment;) {
+            const auto next = segment->nextFree;
+            segment->~Segment();
+            Allocator::Deallocate(segment, sizeof(Segment), alignof(Segment));
+            segment = next;
+        }
+    }
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, std::size_t MaxFreeSegmentCount>
+inline kF::Core::SegmentedMPSCQueue<Type, Allocator, SegmentCapacity, MaxFreeSegmentCount>::SegmentedMPSCQueue(void) noexcept
+{
+    _head = acquireSegment();
+    _head->reserve.store(0, std::memory_order_relaxed);
+    _tail.store(_head, std::memory_order_release);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, std::size_t MaxFreeSegmentCount>
+template<bool MoveOnSuccess, typename ...Args>
+inline bool kF::Core::SegmentedMPSCQueue<Type, Allocator, SegmentCapacity, MaxFreeSegmentCount>::push(Args &&...args) noexcept
+{
+    // Segments loaded from the tail may only be returned to the allocator once every pushing producer is over
+    _pushCount.fetch_add(1, std::memory_order_acquire);
+    while (true) {
+        const auto segment = _tail.load(std::memory_order_acquire);
+        const auto index = segment->reserve.fetch_add(1, std::memory_order_acq_rel);
+
+        // Reservation succeeded, construct then publish the element
+        if (index < SegmentCapacity) [[likely]] {
+            auto &cell = segment->cells[index];
+            if constexpr (MoveOnSuccess)
+                new (&cell.data) Type(std::move(args)...);
+            else
+                new (&cell.data) Type(std::forward<Args>(args)...);
+            cell.ready.store(true, std::memory_order_release);
+            _pushCount.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+        // The first producer to overflow the segment links the next one, others wait for the link
+        if (index == SegmentCapacity)
+            linkSegment(segment);
+        else
+            CpuRelax();
+    }
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, std::size_t MaxFreeSegmentCount>
+inline bool kF::Core::SegmentedMPSCQueue<Type, Allocator, SegmentCapacity, MaxFreeSegmentCount>::pop(Type &value) noexcept
+{
+    // Move to the next segment once the current one is consumed
+    if (_headIndex == SegmentCapacity) [[unlikely]] {
+        const auto next = _head->next.load(std::memory_order_acquire);
+        if (!next) {
+            if (_retired) [[unlikely]]
+                releaseRetiredSegments();
+            return false;
+        }
+        releaseSegment(_head);
+        _head = next;
+        _headIndex = 0;
+    }
+
+    auto &cell = _head->cells[_headIndex];
+    if (!cell.ready.load(std::memory_order_acquire)) {
+        if (_retired) [[unlikely]]
+            releaseRetiredSegments();
+        return false;
+    }
+    auto * const elem = reinterpret_cast<Type *>(&cell.data);
+    if constexpr (std::is_move_assignable_v<Type>)
+        value = std::move(*elem);
+    else
+        value = *elem;
+    elem->~Type();
+    cell.ready.store(false, std::memory_order_relaxed);
+    ++_headIndex;
+    return true;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, std::size_t MaxFreeSegmentCount>
+inline typename kF::Core::SegmentedMPSCQueue<Type, Allocator, SegmentCapacity, MaxFreeSegmentCount>::Segment *
+    kF::Core::SegmentedMPSCQueue<Type, Allocator, SegmentCapacity, MaxFreeSegmentCount>::acquireSegment(void) noexcept
+{
+    // Only one producer can link a segment at a time so poping the free list is ABA safe
+    auto segment = _freeList.load(std::memory_order_acquire);
+    while (segment && !_freeList.compare_exchange_weak(segment, segment->nextFree, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    // A recycled segment keeps its overflowed reservation count until linked, so late producers can't reserve into it
+    if (segment) {
+        _freeCount.fetch_sub(1, std::memory_order_relaxed);
+        segment->next.store(nullptr, std::memory_order_relaxed);
+    }
+    else {
+        segment = reinterpret_cast<Segment *>(Allocator::Allocate(sizeof(Segment), alignof(Segment)));
+        kFEnsure(segment, "Core::SegmentedMPSCQueue: Allocation of segment failed");
+        new (segment) Segment {};
+    }
+    return segment;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, std::size_t MaxFreeSegmentCount>
+inline void kF::Core::SegmentedMPSCQueue<Type, Allocator, SegmentCapacity, MaxFreeSegmentCount>::releaseSegment(Segment * const segment) noexcept
+{
+    // Segment memory must stay valid as late producers may still reserve into it
+    if (_freeCount.load(std::memory_order_relaxed) < MaxFreeSegmentCount) {
+        _freeCount.fetch_add(1, std::memory_order_relaxed);
+        segment->nextFree = _freeList.load(std::memory_order_relaxed);
+        while (!_freeList.compare_exchange_weak(segment->nextFree, segment, std::memory_order_release, std::memory_order_relaxed));
+    } else {
+        segment->nextFree = _retired;
+        _retired = segment;
+        releaseRetiredSegments();
+    }
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, std::size_t MaxFreeSegmentCount>
+inline void kF::Core::SegmentedMPSCQueue<Type, Allocator, SegmentCapacity, MaxFreeSegmentCount>::releaseRetiredSegments(void) noexcept
+{
+    // A retired segment is either behind the tail or still being linked by a pushing producer
+    // Once no producer is pushing, new producers synchronize with the last one and can't load it anymore
+    if (_pushCount.load(std::memory_order_acquire))
+        return;
+    for (auto segment = _retired; segment;) {
+        const auto next = segment->nextFree;
+        segment->~Segment();
+        Allocator::Deallocate(segment, sizeof(Segment), alignof(Segment));
+        segment = next;
+    }
+    _retired = nullptr;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator, std::size_t SegmentCapacity, std::size_t MaxFreeSegmentCount>
+inline void kF::Core::SegmentedMPSCQueue<Type, Allocator, SegmentCapacity, MaxFreeSegmentCount>::linkSegment(Segment * const segment) noexcept
+{
+    const auto next = acquireSegment();
+    segment->next.store(next, std::memory_order_release);
+    _tail.store(next, std::memory_order_release);
+    // Open reservations only once linked, late producers that loaded a recycled segment now push into the tail
+    next->reserve.store(0, std::memory_order_release);
+}
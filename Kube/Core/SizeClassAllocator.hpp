@@ -0,0 +1,197 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Thread safe size class allocator
+ */
+
+#pragma once
+
+#include <bit>
+
+#include "SafeAllocator.hpp"
+
+namespace kF::Core
+{
+    template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower,
+            kF::Core::StackProviderRequirements StackProvider>
+    class SizeClassAllocator;
+
+    namespace AllocatorUtils
+    {
+        /** @brief Compile-time table of size classes
+         *  Classes start at 1 << MinSizePower then each doubling is split into 1 << ClassesPerDoublingPower evenly spaced classes,
+         *  the spacing never being lower than 16 bytes so that atomic buckets keep at least 16 tag values:
+         *  32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, ... (with MinSizePower = 5 and ClassesPerDoublingPower = 2)
+         *  Each class is aligned over its lowest set bit, so power of 2 classes keep the alignment guarantees of SafeAllocator */
+        template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t ClassesPerDoublingPower>
+        struct SizeClassTable
+        {
+            /** @brief Granularity of the lookup table, which is the smallest spacing between two classes */
+            static constexpr std::size_t LookupShift = 4;
+
+            /** @brief Number of entries in the lookup table */
+            static constexpr std::size_t LookupSize = (1ul << MaxSizePower) >> LookupShift;
+
+
+            static_assert(MinSizePower >= LookupShift, "MinSizePower must be superior or equal to LookupShift");
+            static_assert(MinSizePower < MaxSizePower, "MinSizePower must be inferior to MaxSizePower");
+
+
+            /** @brief Spacing between two classes of a doubling */
+            [[nodiscard]] static constexpr std::size_t GetSpacing(const std::size_t power) noexcept
+                { return std::max((1ul << power) >> ClassesPerDoublingPower, 1ul << LookupShift); }
+
+            /** @brief Number of classes */
+            static constexpr std::size_t ClassCount = [] {
+                std::size_t count = 1;
+                for (std::size_t power = MinSizePower; power != MaxSizePower; ++power)
+                    count += (1ul << power) / GetSpacing(power);
+                return count;
+            }();
+
+            /** @brief Class index type */
+            using ClassIndex = std::conditional_t<(ClassCount <= UINT8_MAX), std::uint8_t, std::uint16_t>;
+
+
+            /** @brief Size of each class */
+            static constexpr std::array<std::size_t, ClassCount> Sizes = [] {
+                std::array<std::size_t, ClassCount> sizes {};
+                std::size_t index = 0;
+                sizes[index++] = 1ul << MinSizePower;
+                for (std::size_t power = MinSizePower; power != MaxSizePower; ++power) {
+                    const auto spacing = GetSpacing(power);
+                    for (auto size = (1ul << power) + spacing; size <= (1ul << (power + 1)); size += spacing)
+                        sizes[index++] = size;
+                }
+                return sizes;
+            }();
+
+            /** @brief Alignment of each class (lowest set bit of its size) */
+            static constexpr std::array<std::size_t, ClassCount> Alignments = [] {
+                std::array<std::size_t, ClassCount> alignments {};
+                for (std::size_t i = 0; i != ClassCount; ++i)
+                    alignments[i] = Sizes[i] & (~Sizes[i] + 1);
+                return alignments;
+            }();
+
+            /** @brief Lookup table from '(size - 1) >> LookupShift' to the smallest class able to hold it */
+            static constexpr std::array<ClassIndex, LookupSize> Lookup = [] {
+                std::array<ClassIndex, LookupSize> lookup {};
+                for (std::size_t i = 0, classIndex = 0; i != LookupSize; ++i) {
+                    const auto size = (i + 1) << LookupShift;
+                    while (Sizes[classIndex] < size)
+                        ++classIndex;
+                    lookup[i] = static_cast<ClassIndex>(classIndex);
+                }
+                return lookup;
+            }();
+
+
+            /** @brief Get the class index of an allocation (constant time unless alignment exceeds the natural class alignment)
+             *  @note 'max(size, alignment)' must be inferior or equal to 1 << MaxSizePower */
+            [[nodiscard]] static inline std::size_t GetClassIndex(const std::size_t size, const std::size_t alignment) noexcept
+            {
+                std::size_t classIndex = size ? Lookup[(size - 1) >> LookupShift] : 0u;
+                while (Alignments[classIndex] < alignment) [[unlikely]]
+                    ++classIndex;
+                return classIndex;
+            }
+        };
+    }
+}
+
+/** @brief Synchronized memory allocator using non power of 2 size classes, used for general purposes allocations with threading support.
+ *  Strength:   + Allocations waste at most one class spacing instead of up to 50% with SafeAllocator
+ *              + Size to class lookup is a single constexpr table access
+ *  Weakness:   - Stack fragmentation is slower than SafeAllocator as classes do not tile perfectly
+ *              - No thread local magazines
+ *
+ *  The implementation reuses the stacks and atomic buckets of SafeAllocator, only the bucket layout differs.
+ *  A request with an alignment greater than the natural alignment of its class is moved to the next suitable class.
+ *
+ *  @tparam MinSizePower The minimal allocation size a bucket can store
+ *  @tparam MaxSizePower The maximal allocation size a bucket can store
+ *  @tparam MaxStackSizePower The maximal allocation size a stack can have
+ *  @tparam ClassesPerDoublingPower Power of 2 of the number of classes between two powers of 2
+ *  @tparam StackProvider The provider used to reserve and release stacks
+*/
+template<std::size_t MinSizePower = 5, std::size_t MaxSizePower = 12, std::size_t MaxStackSizePower = 16, std::size_t ClassesPerDoublingPower = 2,
+        kF::Core::StackProviderRequirements StackProvider = kF::Core::DefaultStackProvider>
+class alignas_double_cacheline kF::Core::SizeClassAllocator : public IAllocator
+{
+public:
+    /** @brief Size class table */
+    using Table = AllocatorUtils::SizeClassTable<MinSizePower, MaxSizePower, ClassesPerDoublingPower>;
+
+    /** @brief Minimum retained allocation size in byte */
+    static constexpr std::size_t MinSize = 1ul << MinSizePower;
+
+    /** @brief Maximum retained allocation size in byte */
+    static constexpr std::size_t MaxSize = 1ul << MaxSizePower;
+
+    /** @brief Number of bucket to retain */
+    static constexpr std::size_t BucketCount = Table::ClassCount;
+
+    /** @brief Maximum stack allocation size in byte */
+    static constexpr std::size_t MaxStackSize = 1ul << MaxStackSizePower;
+
+
+    static_assert(MaxStackSize > MaxSize);
+
+
+    /** @brief Virtual destructor ! NOT THREAD SAFE ! */
+    ~SizeClassAllocator(void) noexcept override;
+
+    /** @brief Constructor */
+    SizeClassAllocator(void) noexcept;
+
+
+    /** @brief Allocate function implementation */
+    [[nodiscard]] void *allocate(const std::size_t size, const std::size_t alignment) noexcept override;
+
+    /** @brief Deallocate function implementation */
+    void deallocate(void * const data, const std::size_t size, const std::size_t alignment) noexcept override;
+
+
+    /** @brief Check if the allocator still has allocations
+     *  @note This function is slow */
+    [[nodiscard]] bool empty(void) noexcept;
+
+
+    /** @brief Get a snapshot of allocator statistics
+     *  @note Statistics are empty unless KUBE_ALLOCATOR_STATS is enabled */
+    void stats(AllocatorStats &out) const noexcept;
+
+private:
+    /** @brief Allocate data from a specific bucket */
+    [[nodiscard]] void *allocateFromBucket(const std::size_t classIndex) noexcept;
+
+    /** @brief Allocate a chunk from stack */
+    [[nodiscard]] void *allocateFromStack(const std::size_t classIndex) noexcept;
+
+
+    /** @brief Build a new stack for internal allocation, considering the size of queried class */
+    [[nodiscard]] AllocatorUtils::SafeStackMetaData *buildStack(const std::size_t classSize) noexcept;
+
+
+    /** @brief Fragment stack until end */
+    void fragmentStack(AllocatorUtils::SafeStackMetaData * const stack) noexcept;
+
+    /** @brief Fragment a single block of the stack into the largest suitable classes */
+    void fragmentStackBlock(AllocatorUtils::SafeStackMetaData * const stack, const std::size_t size) noexcept;
+
+
+    // Cacheline 0
+    alignas_cacheline const std::size_t _pageSize;
+    // Cacheline 1
+    alignas_cacheline std::atomic<std::size_t> _maxStackSize { 0u };
+    // Cacheline 2
+    alignas_cacheline AllocatorUtils::AtomicStack _stack {}; // N stacks can be linked at a time
+    // Cacheline 3
+    alignas_cacheline AllocatorUtils::AtomicStack _busyStack {};
+    // Cacheline 4 + (1 per bucket)
+    std::array<AllocatorUtils::AlignedAtomicBucket<1ul << Table::LookupShift>, BucketCount> _buckets {};
+    // Statistics (empty unless enabled)
+    [[no_unique_address]] AllocatorUtils::StatsCounters<MinSizePower, BucketCount, true> _stats {};
+};
+
+#include "SizeClassAllocator.ipp"
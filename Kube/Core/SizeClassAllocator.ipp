@@ -0,0 +1,204 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Thread safe size class allocator
+ */
+
+#include "SizeClassAllocator.hpp"
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::~SizeClassAllocator(void) noexcept
+{
+    while (true) {
+        auto stack = AllocatorUtils::TryStealAtomicStack(_stack);
+        if (stack)
+            AllocatorUtils::InsertAtomicStack(_busyStack, stack);
+        else
+            break;
+    }
+
+    AllocatorUtils::DestroySafeAllocator(_pageSize, _busyStack.load().get(), &StackProvider::DeallocateStack);
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::SizeClassAllocator(void) noexcept
+    : _pageSize(Platform::GetPageSize())
+{
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline void *kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::allocate(const std::size_t size, const std::size_t alignment) noexcept
+{
+    void *data = nullptr;
+
+    // If the size fits into the maximum size a bucket can hold, look for existing buckets
+    if (std::max(size, alignment) <= MaxSize) [[likely]] {
+        const auto classIndex = Table::GetClassIndex(size, alignment);
+        data = allocateFromBucket(classIndex);
+        _stats.onAllocate(classIndex, 1u);
+    // The required size is out of buckets retention range
+    } else [[unlikely]] {
+        data = AllocatorUtils::FallbackAllocate(size, alignment);
+        _stats.onFallbackAllocate(size);
+    }
+
+    return data;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline void kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::deallocate(void * const data, const std::size_t size, const std::size_t alignment) noexcept
+{
+    // If the size is retainable, insert it into a bucket
+    if (data && std::max(size, alignment) <= MaxSize) [[likely]] {
+        const auto classIndex = Table::GetClassIndex(size, alignment);
+        AllocatorUtils::InsertAtomicBucket(_buckets[classIndex].value, data);
+        _stats.onDeallocate(classIndex, 1u);
+    // Else deallocate it
+    } else [[unlikely]] {
+        if (data)
+            _stats.onFallbackDeallocate(size);
+        AllocatorUtils::FallbackDeallocate(data, size, alignment);
+    }
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline void *kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::allocateFromBucket(const std::size_t classIndex) noexcept
+{
+    // Try perfect bucket fit if possible
+    auto data = AllocatorUtils::TryStealAtomicBucket(_buckets[classIndex].value);
+    // Else, allocate from a stack
+    if (!data) [[unlikely]]
+        data = allocateFromStack(classIndex);
+    return data;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline void *kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::allocateFromStack(const std::size_t classIndex) noexcept
+{
+    const auto classSize = Table::Sizes[classIndex];
+    const auto classAlignment = Table::Alignments[classIndex];
+    void *data {};
+
+    // Steal a stack
+    auto stack = AllocatorUtils::TryStealAtomicStack(_stack);
+
+    while (true) {
+        // Check for an existing stack
+        if (stack) [[likely]] {
+            const auto base = reinterpret_cast<std::uintptr_t>(stack);
+            const auto head = ((base + stack->head + classAlignment - 1) & ~(classAlignment - 1)) - base;
+
+            // If the stack can allocate the required memory, reserve it
+            if (head + classSize <= stack->size) [[likely]] {
+                // Try to fragment any padding introduced by alignment
+                if (head != stack->head)
+                    fragmentStackBlock(stack, head - stack->head);
+                data = stack->dataAt(head);
+                stack->head += classSize;
+                break;
+
+            // Else the stack is insufficient to hold the allocation, fragment it and put it in busy list
+            } else [[unlikely]] {
+                fragmentStack(stack);
+                stack = nullptr;
+            }
+
+        // No stack are allocated, build a new one
+        } else if (stack = buildStack(classSize); !stack) [[unlikely]] {
+            return nullptr;
+        }
+    }
+    // Insert the stack in active list
+    if (stack->head != stack->size)
+        AllocatorUtils::InsertAtomicStack(_stack, stack);
+    else
+        AllocatorUtils::InsertAtomicStack(_busyStack, stack);
+    return data;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline kF::Core::AllocatorUtils::SafeStackMetaData *kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::buildStack(const std::size_t classSize) noexcept
+{
+    // Stacks are kept as powers of 2 so that any stack provider can carve them
+    auto maxStackSize = _maxStackSize.load(std::memory_order_acquire);
+    auto stackSize = AllocatorUtils::GetStackSize<sizeof(AllocatorUtils::SafeStackMetaData), MaxStackSize>(
+        std::bit_ceil(classSize),
+        _pageSize,
+        maxStackSize
+    );
+    const auto data = StackProvider::AllocateStack(stackSize, _pageSize);
+    AllocatorUtils::SafeStackMetaData *stack {};
+    if (data) [[likely]] {
+        _stats.onStack(stackSize);
+        stack = new (data) AllocatorUtils::SafeStackMetaData {
+            .size = stackSize,
+            .head = sizeof(AllocatorUtils::SafeStackMetaData),
+            .next = nullptr
+        };
+    }
+
+    // Set max stack size if higher than previous
+    while (maxStackSize < stackSize && !_maxStackSize.compare_exchange_weak(maxStackSize, stackSize, std::memory_order_acq_rel));
+
+    return stack;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline void kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::fragmentStack(AllocatorUtils::SafeStackMetaData * const stack) noexcept
+{
+    // Fragment all available stack size
+    _stats.onFragmentation();
+    fragmentStackBlock(stack, stack->size - stack->head);
+
+    // Insert the stack in busy list
+    AllocatorUtils::InsertAtomicStack(_busyStack, stack);
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline void kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::fragmentStackBlock(AllocatorUtils::SafeStackMetaData * const stack, const std::size_t size) noexcept
+{
+    const auto base = reinterpret_cast<std::uintptr_t>(stack);
+    auto availableSize = size;
+    auto head = stack->head;
+
+    // Increment the real head in order to skip memory if not fragmentable
+    stack->head += size;
+
+    // Loop until no class can fit into the size left
+    while (availableSize >= MinSize) {
+        // Find the largest class that fits available size and is aligned at head
+        auto classIndex = BucketCount;
+        while (classIndex) {
+            --classIndex;
+            if (Table::Sizes[classIndex] <= availableSize && !((base + head) & (Table::Alignments[classIndex] - 1)))
+                break;
+            else if (!classIndex)
+                return;
+        }
+
+        // Insert the block into its bucket
+        AllocatorUtils::InsertAtomicBucket(_buckets[classIndex].value, stack->dataAt(head));
+        _stats.onFragmentedBlock(classIndex);
+
+        // Reduce available size by fragmented block size
+        head += Table::Sizes[classIndex];
+        availableSize -= Table::Sizes[classIndex];
+    }
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline bool kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::empty(void) noexcept
+{
+    for (const auto &bucket : _buckets) {
+        if (bucket.value.load(std::memory_order_acquire))
+            return false;
+    }
+    return true;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower, std::size_t ClassesPerDoublingPower, kF::Core::StackProviderRequirements StackProvider>
+inline void kF::Core::SizeClassAllocator<MinSizePower, MaxSizePower, MaxStackSizePower, ClassesPerDoublingPower, StackProvider>::stats(AllocatorStats &out) const noexcept
+{
+    _stats.snapshot(out);
+    for (std::size_t i = 0u; i != out.buckets.size(); ++i)
+        out.buckets[i].size = Table::Sizes[i];
+}
@@ -0,0 +1,159 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Stack providers of allocators
+ */
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+#include "Vector.hpp"
+#include "StackProvider.hpp"
+
+#if KUBE_PLATFORM_WINDOWS
+# include <windows.h>
+#else
+# include <sys/mman.h>
+#endif
+
+using namespace kF;
+
+/** @brief Alignment of the reserved region, matching the size of a huge page */
+constexpr std::size_t HugePageSize = static_cast<std::size_t>(1u) << 21u;
+
+/** @brief Number of stack size classes (one per power of 2) */
+constexpr std::size_t StackSizeClassCount = sizeof(std::size_t) * 8;
+
+/** @brief Virtual region reserved once and shared by all allocators
+ *  @note The region is reserved for the whole process lifetime and never unmapped, released stacks
+ *        only give back their physical memory. Each size class free list is thus bounded by the
+ *        number of stacks of this size that fit the region */
+struct VirtualRegion
+{
+    std::mutex mutex {};
+    std::atomic<std::uint8_t *> begin {};
+    std::size_t head { 0u };
+    bool reserved { false };
+    std::array<Core::Vector<void *>, StackSizeClassCount> freeStacks {};
+};
+
+/** @brief Get the global virtual region
+ *  @note The region is never destroyed as static allocators may release stacks after static destruction */
+[[nodiscard]] static VirtualRegion &GetVirtualRegion(void) noexcept
+{
+    static VirtualRegion * const Region = new VirtualRegion {};
+
+    return *Region;
+}
+
+/** @brief Reserve the virtual region, aligned over the size of a huge page */
+static void ReserveVirtualRegion(VirtualRegion &region) noexcept
+{
+    constexpr auto ReserveSize = Core::VirtualStackProvider::ReservedSize + HugePageSize;
+
+    region.reserved = true;
+#if KUBE_PLATFORM_WINDOWS
+    auto data = VirtualAlloc(nullptr, ReserveSize, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    auto data = mmap(nullptr, ReserveSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (data == MAP_FAILED) [[unlikely]]
+        data = nullptr;
+#endif
+    if (!data) [[unlikely]]
+        return;
+
+    const auto address = reinterpret_cast<std::uintptr_t>(data);
+    const auto begin = reinterpret_cast<std::uint8_t *>((address + HugePageSize - 1) & ~(HugePageSize - 1));
+#if !KUBE_PLATFORM_WINDOWS && defined(MADV_HUGEPAGE)
+    madvise(begin, Core::VirtualStackProvider::ReservedSize, MADV_HUGEPAGE);
+#endif
+    region.begin.store(begin, std::memory_order_release);
+}
+
+/** @brief Commit the physical memory of a stack if required by the platform */
+[[nodiscard]] static bool CommitStack([[maybe_unused]] void * const data, [[maybe_unused]] const std::size_t size) noexcept
+{
+#if KUBE_PLATFORM_WINDOWS
+    return VirtualAlloc(data, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    return true;
+#endif
+}
+
+/** @brief Release the physical memory of a stack while keeping its address range reserved */
+static void ReleaseStack(void * const data, const std::size_t size) noexcept
+{
+#if KUBE_PLATFORM_WINDOWS
+    VirtualFree(data, size, MEM_DECOMMIT);
+#else
+    madvise(data, size, MADV_DONTNEED);
+#endif
+}
+
+void *Core::VirtualStackProvider::AllocateStack(const std::size_t size, const std::size_t alignment) noexcept
+{
+    // Only power of 2 stacks aligned over their size can be carved
+    if (!Core::IsPowerOf2(size) || alignment > size) [[unlikely]]
+        return AllocatorUtils::FallbackAllocate(size, alignment);
+
+    auto &region = GetVirtualRegion();
+    void *data {};
+    {
+        std::lock_guard lock(region.mutex);
+
+        // Reuse a released stack of the same size
+        auto &freeStacks = region.freeStacks[Core::NextPowerOf2Bit(size)];
+        if (!freeStacks.empty()) {
+            data = freeStacks.back();
+            freeStacks.pop();
+        // Carve a new stack from the region
+        } else {
+            if (!region.reserved) [[unlikely]]
+                ReserveVirtualRegion(region);
+            // The region is only aligned over a huge page, so align the absolute address for larger stacks
+            const auto begin = region.begin.load(std::memory_order_relaxed);
+            const auto address = reinterpret_cast<std::uintptr_t>(begin);
+            const auto head = ((address + region.head + size - 1) & ~(size - 1)) - address;
+            if (begin && head + size <= ReservedSize) [[likely]] {
+                data = begin + head;
+                region.head = head + size;
+            }
+        }
+    }
+
+    if (!data) [[unlikely]]
+        return AllocatorUtils::FallbackAllocate(size, alignment);
+    else if (!CommitStack(data, size)) [[unlikely]] {
+        DeallocateStack(data, size, alignment);
+        return nullptr;
+    }
+    return data;
+}
+
+void Core::VirtualStackProvider::DeallocateStack(void * const data, const std::size_t size, const std::size_t alignment) noexcept
+{
+    if (!Owns(data)) [[unlikely]]
+        return AllocatorUtils::FallbackDeallocate(data, size, alignment);
+
+    ReleaseStack(data, size);
+
+    auto &region = GetVirtualRegion();
+    std::lock_guard lock(region.mutex);
+    region.freeStacks[Core::NextPowerOf2Bit(size)].push(data);
+}
+
+std::size_t Core::VirtualStackProvider::ReservedBytes(void) noexcept
+{
+    auto &region = GetVirtualRegion();
+    std::lock_guard lock(region.mutex);
+
+    return region.head;
+}
+
+bool Core::VirtualStackProvider::Owns(const void * const data) noexcept
+{
+    const auto begin = GetVirtualRegion().begin.load(std::memory_order_acquire);
+    const auto ptr = reinterpret_cast<const std::uint8_t *>(data);
+
+    return begin && ptr >= begin && ptr < begin + ReservedSize;
+}
@@ -0,0 +1,61 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Stack providers of allocators
+ */
+
+#pragma once
+
+#include "AllocatorUtils.hpp"
+
+namespace kF::Core
+{
+    /** @brief Concept of a stack provider, used by allocators to reserve their stacks */
+    template<typename Type>
+    concept StackProviderRequirements = requires(void *data, std::size_t size, std::size_t alignment)
+    {
+        { Type::AllocateStack(size, alignment) } -> std::same_as<void *>;
+        { Type::DeallocateStack(data, size, alignment) } -> std::same_as<void>;
+    };
+
+    /** @brief Default stack provider that forwards to AlignedAlloc */
+    struct DefaultStackProvider
+    {
+        /** @brief Allocate a stack */
+        [[nodiscard]] static inline void *AllocateStack(const std::size_t size, const std::size_t alignment) noexcept
+            { return AllocatorUtils::FallbackAllocate(size, alignment); }
+
+        /** @brief Deallocate a stack */
+        static inline void DeallocateStack(void * const data, const std::size_t size, const std::size_t alignment) noexcept
+            { AllocatorUtils::FallbackDeallocate(data, size, alignment); }
+    };
+    static_assert(StackProviderRequirements<DefaultStackProvider>, "Default stack provider doesn't meet requirements");
+
+    /** @brief Stack provider that carves stacks from a single large reserved virtual region
+     *  Strength:   + Stacks are contiguous and backed by transparent huge pages when available (less TLB misses)
+     *              + Released stacks give their physical memory back to the OS and their address range is recycled
+     *  Weakness:   - Stack sizes must be powers of 2 (which is the case of SafeAllocator stacks)
+     *              - Allocators only release their stacks on destruction: free blocks stay linked into their buckets,
+     *                so the memory of a running allocator is never given back, even if all its blocks are free
+     *
+     *  The region is reserved once for the whole process lifetime, its address space is never unmapped.
+     *  When the region is exhausted or cannot be reserved, the provider falls back to AlignedAlloc. */
+    struct VirtualStackProvider
+    {
+        /** @brief Size of the reserved virtual region */
+        static constexpr std::size_t ReservedSize = static_cast<std::size_t>(1u) << 32u;
+
+        /** @brief Allocate a stack, aligned over its size */
+        [[nodiscard]] static void *AllocateStack(const std::size_t size, const std::size_t alignment) noexcept;
+
+        /** @brief Deallocate a stack, its physical memory is released to the OS
+         *  @note Allocators only deallocate their stacks on destruction */
+        static void DeallocateStack(void * const data, const std::size_t size, const std::size_t alignment) noexcept;
+
+        /** @brief Get the number of bytes currently carved from the reserved region (including released stacks) */
+        [[nodiscard]] static std::size_t ReservedBytes(void) noexcept;
+
+        /** @brief Check if a pointer is owned by the reserved region */
+        [[nodiscard]] static bool Owns(const void * const data) noexcept;
+    };
+    static_assert(StackProviderRequirements<VirtualStackProvider>, "Virtual stack provider doesn't meet requirements");
+}
@@ -6,7 +6,8 @@
 #pragma once
 
 #include "FixedString.hpp"
-#include "Utils.hpp"
+#include "AllocatorUtils.hpp"
+#include "AllocatorStats.hpp"
 
 namespace kF::Core
 {
@@ -20,6 +21,7 @@ namespace kF::Core
         struct StaticAllocatorInstance
         {
             Allocator *allocator {};
+            std::string_view name {}; // Name registered into the statistics registry
             bool destroyPending {};
 
 
@@ -43,7 +45,22 @@ public:
     /** @brief Deallocate function that forward to AlignedFree */
     static void Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept;
 
+
+    /** @brief Allocate 'count' blocks of the same size and alignment into 'out'
+     *  @return True on success, on failure no allocation is retained */
+    [[nodiscard]] static bool AllocateBatch(const std::size_t bytes, const std::size_t alignment, const std::size_t count, void ** const out) noexcept;
+
+    /** @brief Deallocate 'count' blocks of the same size and alignment */
+    static void DeallocateBatch(const std::size_t bytes, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept;
+
+    /** @brief Get a snapshot of allocator statistics, returns false if the allocator has no instance or no statistics
+     *  @note Every static allocator is also queryable by name using AllocatorUtils::QueryAllocatorStats */
+    [[nodiscard]] static bool Stats(AllocatorStats &stats) noexcept;
+
 private:
+    /** @brief Create the allocator instance */
+    static void CreateInstance(void) noexcept;
+
     /** @brief Ensure destruction of the allocator when destruction is pending */
     static void EnsureDestruction(void) noexcept;
 
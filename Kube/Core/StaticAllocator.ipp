@@ -12,7 +12,7 @@ inline void *kF::Core::StaticAllocator<Allocator, Name>::Allocate(const std::siz
 AllocateLabel:
         return _Instance.allocator->allocate(bytes, alignment);
     } else [[unlikely]] {
-        _Instance.allocator = new Allocator();
+        CreateInstance();
         goto AllocateLabel;
     }
 }
@@ -27,6 +27,56 @@ inline void kF::Core::StaticAllocator<Allocator, Name>::Deallocate(void * const
     }
 }
 
+template<kF::Core::AllocatorRequirements Allocator, kF::Core::FixedString Name>
+inline bool kF::Core::StaticAllocator<Allocator, Name>::AllocateBatch(
+        const std::size_t bytes, const std::size_t alignment, const std::size_t count, void ** const out) noexcept
+{
+    if (!_Instance.allocator) [[unlikely]]
+        CreateInstance();
+
+    if constexpr (requires { _Instance.allocator->allocateBatch(bytes, alignment, count, out); })
+        return _Instance.allocator->allocateBatch(bytes, alignment, count, out);
+    else
+        return AllocatorUtils::FallbackAllocateBatch(*_Instance.allocator, bytes, alignment, count, out);
+}
+
+template<kF::Core::AllocatorRequirements Allocator, kF::Core::FixedString Name>
+inline void kF::Core::StaticAllocator<Allocator, Name>::DeallocateBatch(
+        const std::size_t bytes, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept
+{
+    if (count) [[likely]] {
+        if constexpr (requires { _Instance.allocator->deallocateBatch(bytes, alignment, count, data); })
+            _Instance.allocator->deallocateBatch(bytes, alignment, count, data);
+        else
+            AllocatorUtils::FallbackDeallocateBatch(*_Instance.allocator, bytes, alignment, count, data);
+        if (_Instance.destroyPending) [[unlikely]]
+            EnsureDestruction();
+    }
+}
+
+template<kF::Core::AllocatorRequirements Allocator, kF::Core::FixedString Name>
+inline bool kF::Core::StaticAllocator<Allocator, Name>::Stats(AllocatorStats &stats) noexcept
+{
+    if constexpr (AllocatorStatsEnabled && requires { _Instance.allocator->stats(stats); }) {
+        if (_Instance.allocator) [[likely]] {
+            _Instance.allocator->stats(stats);
+            return true;
+        }
+    }
+    stats = AllocatorStats {};
+    return false;
+}
+
+template<kF::Core::AllocatorRequirements Allocator, kF::Core::FixedString Name>
+no_inline void kF::Core::StaticAllocator<Allocator, Name>::CreateInstance(void) noexcept
+{
+    _Instance.allocator = new Allocator();
+    if constexpr (AllocatorStatsEnabled) {
+        _Instance.name = Name.toView();
+        AllocatorUtils::RegisterAllocatorStats(_Instance.name, &StaticAllocator::Stats);
+    }
+}
+
 template<kF::Core::AllocatorRequirements Allocator, kF::Core::FixedString Name>
 no_inline void kF::Core::StaticAllocator<Allocator, Name>::EnsureDestruction(void) noexcept
 {
@@ -46,6 +96,9 @@ inline kF::Core::Internal::StaticAllocatorInstance<Allocator>::~StaticAllocatorI
 template<kF::Core::AllocatorRequirements Allocator>
 inline void kF::Core::Internal::StaticAllocatorInstance<Allocator>::destroyInstance(void) noexcept
 {
+    // Wait for running statistics queries before destroying the allocator
+    if constexpr (AllocatorStatsEnabled)
+        AllocatorUtils::UnregisterAllocatorStats(name);
     delete allocator;
     allocator = nullptr;
     destroyPending = false;
@@ -0,0 +1,16 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Thread safe static size class allocator
+ */
+
+#pragma once
+
+#include "SizeClassAllocator.hpp"
+#include "StaticAllocator.hpp"
+
+namespace kF::Core
+{
+    /** @brief Wrapper used to create static size class allocators */
+    template<FixedString Name, std::size_t ...Args>
+    using StaticSizeClassAllocator = StaticAllocator<SizeClassAllocator<Args...>, Name>;
+}
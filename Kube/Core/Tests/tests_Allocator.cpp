@@ -4,6 +4,7 @@
  */
 
 #include <thread>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 
@@ -12,6 +13,7 @@
 #include <Kube/Core/Debug.hpp>
 #include <Kube/Core/UnsafeAllocator.hpp>
 #include <Kube/Core/SafeAllocator.hpp>
+#include <Kube/Core/SizeClassAllocator.hpp>
 
 using namespace kF;
 
@@ -121,6 +123,32 @@ static bool TestAllocatorNoRetention(Allocator &allocator)
     return true;
 }
 
+template<typename Allocator, std::size_t Size, std::size_t Count>
+static bool TestAllocatorBatch(Allocator &allocator)
+{
+    constexpr auto Cycles = KUBE_DEBUG_BUILD ? 10ul : 1000ul;
+
+    std::vector<void *> ptrs(Count);
+    for (std::size_t cycle = 0ul; cycle != Cycles; ++cycle) {
+        if (!allocator.allocateBatch(Size, Size, Count, ptrs.data()))
+            return false;
+        for (std::size_t i = 0ul; i != Count; ++i) {
+            if (!ptrs[i] || reinterpret_cast<std::uintptr_t>(ptrs[i]) % Size)
+                return false;
+            std::memset(ptrs[i], static_cast<int>(i % 256), Size);
+        }
+        for (std::size_t i = 0ul; i != Count; ++i) {
+            if (reinterpret_cast<std::uint8_t *>(ptrs[i])[Size - 1] != static_cast<std::uint8_t>(i % 256))
+                return false;
+        }
+        // Half of the batch is released one by one to mix single and batch paths
+        for (std::size_t i = 0ul; i != Count / 2; ++i)
+            allocator.deallocate(ptrs[i], Size, Size);
+        allocator.deallocateBatch(Size, Size, Count - Count / 2, ptrs.data() + Count / 2);
+    }
+    return true;
+}
+
 TEST(UnsafeAllocator, NoRetention)
 {
     using Allocator = Core::UnsafeAllocator<>;
@@ -142,6 +170,17 @@ TEST(UnsafeAllocator, Retention)
     ASSERT_TRUE(success);
 }
 
+TEST(UnsafeAllocator, Batch)
+{
+    using Allocator = Core::UnsafeAllocator<>;
+
+    Allocator allocator;
+    bool success = TestAllocatorBatch<Allocator, 32, 100>(allocator)
+        && TestAllocatorBatch<Allocator, 256, 1000>(allocator)
+        && TestAllocatorBatch<Allocator, 8192, 10>(allocator);
+    ASSERT_TRUE(success);
+}
+
 TEST(SafeAllocator, NoRetention)
 {
     using Allocator = Core::SafeAllocator<>;
@@ -163,6 +202,37 @@ TEST(SafeAllocator, Retention)
     ASSERT_TRUE(success);
 }
 
+TEST(SafeAllocator, Batch)
+{
+    using Allocator = Core::SafeAllocator<>;
+
+    Allocator allocator;
+    bool success = TestAllocatorBatch<Allocator, 32, 100>(allocator)
+        && TestAllocatorBatch<Allocator, 256, 1000>(allocator)
+        && TestAllocatorBatch<Allocator, 8192, 10>(allocator);
+    ASSERT_TRUE(success);
+}
+
+TEST(SafeAllocator, ThreadingBatch)
+{
+    using Allocator = Core::SafeAllocator<5, 12, 16, 32>;
+
+    Allocator allocator;
+    auto testFunc = [&allocator] {
+        EXPECT_TRUE((TestAllocatorBatch<Allocator, 64, 100>(allocator)));
+        EXPECT_TRUE((TestAllocatorBatch<Allocator, 64, 7>(allocator)));
+    };
+
+    std::vector<std::unique_ptr<std::thread>> thds(std::thread::hardware_concurrency());
+    for (auto &thd : thds) {
+        thd = std::make_unique<std::thread>(testFunc);
+    }
+
+    for (auto &thd : thds) {
+        thd->join();
+    }
+}
+
 // #include <Kube/Core/DebugAllocator.hpp>
 
 TEST(SafeAllocator, ThreadingNoRetention)
@@ -205,4 +275,291 @@ TEST(SafeAllocator, ThreadingRetention)
     for (auto &thd : thds) {
         thd->join();
     }
-}
\ No newline at end of file
+}
+
+TEST(SafeAllocator, MagazineRetention)
+{
+    using Allocator = Core::SafeAllocator<5, 12, 16, 32>;
+
+    Allocator allocator;
+    bool success = TestAllocatorRetention<Allocator, 8u, 256u, ConfigMaxSize, 10>(allocator)
+        && TestAllocatorRetention<Allocator, 8u, 256u, ConfigMaxSize, 100>(allocator)
+        && TestAllocatorRetention<Allocator, 8u, 256u, ConfigMaxSize, 1000>(allocator);
+    ASSERT_TRUE(success);
+    ASSERT_FALSE(allocator.empty());
+}
+
+TEST(SafeAllocator, MagazineThreadingRetention)
+{
+    using Allocator = Core::SafeAllocator<5, 12, 16, 32>;
+
+    Allocator allocator;
+    auto testFunc = [&allocator] {
+        TestAllocatorRetention<Allocator, 8u, 256u, ConfigMediumSize, 10>(allocator);
+        TestAllocatorRetention<Allocator, 8u, 256u, ConfigMediumSize, 100>(allocator);
+        TestAllocatorRetention<Allocator, 8u, 256u, ConfigMediumSize, 1000>(allocator);
+    };
+
+    std::vector<std::unique_ptr<std::thread>> thds(std::thread::hardware_concurrency());
+    for (auto &thd : thds) {
+        thd = std::make_unique<std::thread>(testFunc);
+    }
+
+    for (auto &thd : thds) {
+        thd->join();
+    }
+}
+
+TEST(SafeAllocator, MagazineProducerConsumer)
+{
+    using Allocator = Core::SafeAllocator<5, 12, 16, 32>;
+    constexpr std::size_t Count = KUBE_DEBUG_BUILD ? 1000 : 100000;
+    constexpr std::size_t Size = 64;
+
+    Allocator allocator;
+    std::vector<void *> allocations(Count);
+    std::atomic_size_t produced { 0u };
+
+    // Producer allocates, consumer deallocates: magazines must migrate allocations across threads
+    std::thread producer([&] {
+        for (std::size_t i = 0u; i != Count; ++i) {
+            auto ptr = allocator.allocate(Size, Size);
+            std::memset(ptr, static_cast<int>(i % 256), Size);
+            allocations[i] = ptr;
+            produced.store(i + 1, std::memory_order_release);
+        }
+    });
+    std::thread consumer([&] {
+        for (std::size_t i = 0u; i != Count; ++i) {
+            while (produced.load(std::memory_order_acquire) <= i)
+                std::this_thread::yield();
+            EXPECT_EQ(reinterpret_cast<std::uint8_t *>(allocations[i])[Size - 1], static_cast<std::uint8_t>(i % 256));
+            allocator.deallocate(allocations[i], Size, Size);
+        }
+    });
+    producer.join();
+    consumer.join();
+}
+
+TEST(SafeAllocator, MagazineInstanceSwitch)
+{
+    using Allocator = Core::SafeAllocator<5, 12, 16, 32>;
+
+    void *first {};
+    {
+        // Fill the calling thread magazine then destroy its owner
+        Allocator allocator;
+        first = allocator.allocate(32, 32);
+        allocator.deallocate(first, 32, 32);
+    }
+
+    // The magazine of a destroyed owner must be dropped, not reused
+    Allocator allocator;
+    auto ptr = allocator.allocate(32, 32);
+    ASSERT_NE(ptr, nullptr);
+    std::memset(ptr, 0, 32);
+    allocator.deallocate(ptr, 32, 32);
+    ASSERT_FALSE(allocator.empty());
+}
+
+TEST(SafeAllocator, RemoteFree)
+{
+    using Allocator = Core::SafeAllocator<5, 12, 16, 32, Core::DefaultStackProvider, true>;
+
+    Allocator allocator;
+    auto ptr = allocator.allocate(64, 64);
+    ASSERT_NE(ptr, nullptr);
+
+    // Another thread frees the allocation, which must be given back to its owner
+    std::thread([&allocator, ptr] { allocator.deallocate(ptr, 64, 64); }).join();
+    ASSERT_EQ(allocator.allocate(64, 64), ptr);
+    allocator.deallocate(ptr, 64, 64);
+}
+
+TEST(SafeAllocator, RemoteFreeProducerConsumer)
+{
+    using Allocator = Core::SafeAllocator<5, 12, 16, 32, Core::DefaultStackProvider, true>;
+    constexpr std::size_t Count = KUBE_DEBUG_BUILD ? 1000 : 100000;
+    constexpr std::size_t Size = 64;
+
+    Allocator allocator;
+    std::vector<void *> allocations(Count);
+    std::atomic_size_t produced { 0u };
+
+    std::thread producer([&] {
+        for (std::size_t i = 0u; i != Count; ++i) {
+            auto ptr = allocator.allocate(Size, Size);
+            std::memset(ptr, static_cast<int>(i % 256), Size);
+            allocations[i] = ptr;
+            produced.store(i + 1, std::memory_order_release);
+        }
+    });
+    std::thread consumer([&] {
+        for (std::size_t i = 0u; i != Count; ++i) {
+            while (produced.load(std::memory_order_acquire) <= i)
+                std::this_thread::yield();
+            EXPECT_EQ(reinterpret_cast<std::uint8_t *>(allocations[i])[Size - 1], static_cast<std::uint8_t>(i % 256));
+            allocator.deallocate(allocations[i], Size, Size);
+        }
+    });
+    producer.join();
+    consumer.join();
+
+    bool success = TestAllocatorRetention<Allocator, 8u, 256u, ConfigMaxSize, 100>(allocator);
+    ASSERT_TRUE(success);
+}
+
+TEST(SafeAllocator, Stats)
+{
+    using Allocator = Core::SafeAllocator<>;
+
+    Allocator allocator;
+    Core::AllocatorStats stats;
+
+    void *ptrs[10] {};
+    for (auto &ptr : ptrs)
+        ptr = allocator.allocate(64, 64);
+    auto big = allocator.allocate(Allocator::MaxSize * 2, 16);
+    allocator.stats(stats);
+
+    if constexpr (Core::AllocatorStatsEnabled) {
+        ASSERT_EQ(stats.buckets.size(), Allocator::BucketCount);
+        const auto &bucket = stats.buckets[static_cast<std::uint32_t>(Core::AllocatorUtils::GetBucketIndex<5>(64))];
+        ASSERT_EQ(bucket.size, 64);
+        ASSERT_EQ(bucket.live, 10);
+        ASSERT_EQ(bucket.peak, 10);
+        ASSERT_GE(stats.stackCount, 1);
+        ASSERT_EQ(stats.fallbackCount, 1);
+        ASSERT_EQ(stats.fallbackLiveBytes, Allocator::MaxSize * 2);
+    } else {
+        ASSERT_TRUE(stats.buckets.empty());
+    }
+
+    for (auto &ptr : ptrs)
+        allocator.deallocate(ptr, 64, 64);
+    allocator.deallocate(big, Allocator::MaxSize * 2, 16);
+    allocator.stats(stats);
+
+    if constexpr (Core::AllocatorStatsEnabled) {
+        const auto &bucket = stats.buckets[static_cast<std::uint32_t>(Core::AllocatorUtils::GetBucketIndex<5>(64))];
+        ASSERT_EQ(bucket.live, 0);
+        ASSERT_EQ(bucket.peak, 10);
+        ASSERT_EQ(stats.fallbackLiveBytes, 0);
+        ASSERT_EQ(stats.fallbackPeakBytes, Allocator::MaxSize * 2);
+    }
+}
+
+TEST(SafeAllocator, VirtualStackProvider)
+{
+    using Allocator = Core::SafeAllocator<5, 12, 16, 0, Core::VirtualStackProvider>;
+
+    std::size_t reserved {};
+    {
+        Allocator allocator;
+        bool success = TestAllocatorRetention<Allocator, 8u, 256u, ConfigMaxSize, 100>(allocator);
+        ASSERT_TRUE(success);
+        reserved = Core::VirtualStackProvider::ReservedBytes();
+        ASSERT_NE(reserved, 0);
+    }
+
+    // Released stacks must be recycled instead of carving new ones
+    Allocator allocator;
+    bool success = TestAllocatorRetention<Allocator, 8u, 256u, ConfigMaxSize, 100>(allocator);
+    ASSERT_TRUE(success);
+    ASSERT_EQ(Core::VirtualStackProvider::ReservedBytes(), reserved);
+}
+
+TEST(SafeAllocator, VirtualStackProviderLargeStacks)
+{
+    // Stacks larger than a huge page must still be aligned over their own size
+    constexpr std::size_t SmallSize = static_cast<std::size_t>(1u) << 12u;
+
+    for (std::size_t power = 22u; power != 28u; ++power) {
+        const std::size_t largeSize = static_cast<std::size_t>(1u) << power;
+        const auto small = Core::VirtualStackProvider::AllocateStack(SmallSize, SmallSize);
+        const auto large = Core::VirtualStackProvider::AllocateStack(largeSize, largeSize);
+        ASSERT_TRUE(Core::VirtualStackProvider::Owns(large));
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(large) & (largeSize - 1), 0);
+        Core::VirtualStackProvider::DeallocateStack(large, largeSize, largeSize);
+        Core::VirtualStackProvider::DeallocateStack(small, SmallSize, SmallSize);
+    }
+}
+
+TEST(SizeClassAllocator, Table)
+{
+    using Table = Core::SizeClassAllocator<>::Table;
+
+    ASSERT_EQ(Table::Sizes[Table::GetClassIndex(1, 1)], 32);
+    ASSERT_EQ(Table::Sizes[Table::GetClassIndex(33, 8)], 48);
+    ASSERT_EQ(Table::Sizes[Table::GetClassIndex(72, 8)], 80);
+    ASSERT_EQ(Table::Sizes[Table::GetClassIndex(72, 32)], 96);
+    ASSERT_EQ(Table::Sizes[Table::GetClassIndex(72, 64)], 128);
+    ASSERT_EQ(Table::Sizes[Table::GetClassIndex(129, 8)], 160);
+    ASSERT_EQ(Table::Sizes[Table::GetClassIndex(4096, 8)], 4096);
+    for (std::size_t size = 32; size <= 4096; ++size) {
+        const auto classSize = Table::Sizes[Table::GetClassIndex(size, 16)];
+        ASSERT_GE(classSize, size);
+        ASSERT_LE(classSize - size, std::max<std::size_t>(16, size / 4));
+    }
+}
+
+TEST(SizeClassAllocator, NoRetention)
+{
+    using Allocator = Core::SizeClassAllocator<>;
+
+    Allocator allocator;
+    bool success = TestAllocatorNoRetention<Allocator, 8u, 256u, ConfigMaxSize>(allocator);
+    ASSERT_TRUE(success);
+}
+
+TEST(SizeClassAllocator, Retention)
+{
+    using Allocator = Core::SizeClassAllocator<>;
+
+    Allocator allocator;
+    bool success = TestAllocatorRetention<Allocator, 8u, 256u, ConfigMaxSize, 10>(allocator)
+        && TestAllocatorRetention<Allocator, 8u, 256u, ConfigMaxSize, 100>(allocator)
+        && TestAllocatorRetention<Allocator, 8u, 256u, ConfigMaxSize, 1000>(allocator);
+    ASSERT_TRUE(success);
+}
+
+TEST(SizeClassAllocator, OddSizesRetention)
+{
+    using Allocator = Core::SizeClassAllocator<>;
+
+    Allocator allocator;
+    std::vector<Allocation> retentions;
+    for (std::size_t cycle = 0; cycle != 4; ++cycle) {
+        for (std::size_t size = 24; size <= Allocator::MaxSize; size += 24) {
+            const std::size_t alignment = (size / 24) % 2 ? 8 : 16;
+            retentions.push_back(Allocation {
+                .data = TestAllocationRetention(allocator, size, alignment),
+                .size = size,
+                .alignment = alignment
+            });
+        }
+        ASSERT_TRUE(TestDeallocateRetention(allocator, retentions));
+        retentions.clear();
+    }
+}
+
+TEST(SizeClassAllocator, ThreadingRetention)
+{
+    using Allocator = Core::SizeClassAllocator<>;
+
+    Allocator allocator;
+    auto testFunc = [&allocator] {
+        TestAllocatorRetention<Allocator, 8u, 256u, ConfigMediumSize, 10>(allocator);
+        TestAllocatorRetention<Allocator, 8u, 256u, ConfigMediumSize, 100>(allocator);
+        TestAllocatorRetention<Allocator, 8u, 256u, ConfigMediumSize, 1000>(allocator);
+    };
+
+    std::vector<std::unique_ptr<std::thread>> thds(std::thread::hardware_concurrency());
+    for (auto &thd : thds) {
+        thd = std::make_unique<std::thread>(testFunc);
+    }
+
+    for (auto &thd : thds) {
+        thd->join();
+    }
+}
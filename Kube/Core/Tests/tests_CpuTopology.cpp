@@ -0,0 +1,46 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of CpuTopology
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/CpuTopology.hpp>
+
+using namespace kF;
+
+TEST(CpuTopology, Discover)
+{
+    const auto topology = Core::CpuTopology::Discover();
+    const auto &cpus = topology.cpus();
+
+    ASSERT_FALSE(cpus.empty());
+    ASSERT_GE(topology.nodeCount(), 1u);
+    ASSERT_GE(topology.cacheGroupCount(), 1u);
+    for (auto it = cpus.begin(); it != cpus.end(); ++it) {
+        ASSERT_LT(it->node, topology.nodeCount());
+        ASSERT_LT(it->cacheGroup, topology.cacheGroupCount());
+        // CPUs are sorted by node, then cache group, then index
+        if (it != cpus.begin()) {
+            const auto &prev = *(it - 1);
+            ASSERT_TRUE(prev.node < it->node
+                || (prev.node == it->node && prev.cacheGroup < it->cacheGroup)
+                || (prev.node == it->node && prev.cacheGroup == it->cacheGroup && prev.index < it->index));
+        }
+    }
+}
+
+TEST(CpuTopology, PinCurrentThread)
+{
+    const auto cpu = Core::CpuTopology::Discover().cpus().back().index;
+    bool pinned {};
+
+    std::thread([cpu, &pinned] { pinned = Core::CpuTopology::PinCurrentThread(cpu); }).join();
+#if KUBE_PLATFORM_LINUX || KUBE_PLATFORM_WINDOWS
+    ASSERT_TRUE(pinned);
+#else
+    ASSERT_FALSE(pinned);
+#endif
+}
@@ -0,0 +1,93 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Frame arena tests
+ */
+
+#include <thread>
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/FrameArena.hpp>
+#include <Kube/Core/Vector.hpp>
+
+using namespace kF;
+
+TEST(FrameArena, Basics)
+{
+    using Arena = Core::FrameArena<"TestFrameArenaBasics", 1024>;
+    static_assert(Core::StaticAllocatorRequirements<Arena>, "Frame arena doesn't meet requirements");
+
+    auto first = Arena::Allocate(24, 8);
+    ASSERT_NE(first, nullptr);
+    for (std::size_t alignment = 1; alignment <= 256; alignment *= 2) {
+        auto ptr = Arena::Allocate(3, alignment);
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0);
+    }
+    // Oversized allocation get a dedicated chunk
+    auto large = Arena::Allocate(4096, 64);
+    ASSERT_NE(large, nullptr);
+    ASSERT_GE(Arena::UsedBytes(), 4096 + 24);
+    const auto reserved = Arena::ReservedBytes();
+    ASSERT_GE(reserved, 4096 + 1024);
+
+    // Reset reuses the same chunks
+    for (auto i = 0; i < 10; ++i) {
+        Arena::Reset();
+        ASSERT_EQ(Arena::UsedBytes(), 0);
+        ASSERT_EQ(Arena::Allocate(24, 8), first);
+        ASSERT_NE(Arena::Allocate(4096, 64), nullptr);
+        ASSERT_EQ(Arena::ReservedBytes(), reserved);
+    }
+
+    Arena::Release();
+    ASSERT_EQ(Arena::ReservedBytes(), 0);
+}
+
+TEST(FrameArena, Vector)
+{
+    using Arena = Core::FrameArena<"TestFrameArenaVector", 256>;
+
+    for (auto frame = 0; frame < 4; ++frame) {
+        Core::Vector<std::size_t, Arena> vector;
+        for (std::size_t i = 0; i < 1000; ++i)
+            vector.push(i);
+        for (std::size_t i = 0; i < 1000; ++i)
+            ASSERT_EQ(vector[static_cast<std::uint32_t>(i)], i);
+        vector.release();
+        Arena::Reset();
+    }
+    Arena::Release();
+}
+
+TEST(FrameArena, Threading)
+{
+    using Arena = Core::FrameArena<"TestFrameArenaThreading", 4096>;
+
+    constexpr std::size_t ThreadCount = 4;
+    constexpr std::size_t AllocationCount = 2048;
+    constexpr std::size_t AllocationSize = 24;
+
+    for (auto frame = 0; frame < 3; ++frame) {
+        std::vector<std::uintptr_t> ptrs(ThreadCount * AllocationCount);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < ThreadCount; ++t) {
+            threads.emplace_back([&ptrs, t] {
+                for (std::size_t i = 0; i < AllocationCount; ++i) {
+                    auto ptr = Arena::Allocate(AllocationSize, 8);
+                    std::fill_n(reinterpret_cast<std::uint8_t *>(ptr), AllocationSize, static_cast<std::uint8_t>(t));
+                    ptrs[t * AllocationCount + i] = reinterpret_cast<std::uintptr_t>(ptr);
+                }
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+        // Ensure no allocation overlap
+        std::sort(ptrs.begin(), ptrs.end());
+        for (std::size_t i = 1; i < ptrs.size(); ++i)
+            ASSERT_GE(ptrs[i] - ptrs[i - 1], AllocationSize);
+        Arena::Reset();
+    }
+    Arena::Release();
+}
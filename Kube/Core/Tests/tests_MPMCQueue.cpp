@@ -3,6 +3,7 @@
  * @ Description: Tests of the MPMC Queue
  */
 
+#include <numeric>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -75,4 +76,67 @@ TEST(MPMCQueue, IntensiveThreading)
         if (popThds[i].joinable())
             popThds[i].join();
     }
-}
\ No newline at end of file
+}
+
+TEST(MPMCQueue, RangePushPop)
+{
+    constexpr std::size_t queueSize = 8;
+
+    Core::MPMCQueue<std::string> queue(queueSize);
+    const std::string input[] { "0", "1", "2", "3", "4", "5" };
+    std::string output[queueSize + 1];
+
+    ASSERT_TRUE(queue.tryPushRange(std::begin(input), std::end(input)));
+    ASSERT_FALSE(queue.tryPushRange(std::begin(input), std::end(input)));
+    ASSERT_EQ(queue.pushRange(std::begin(input), std::end(input)), 2);
+    ASSERT_EQ(queue.size(), queueSize);
+    ASSERT_FALSE(queue.tryPopRange(std::begin(output), std::begin(output) + queueSize + 1));
+    ASSERT_EQ(queue.popRange(std::begin(output), std::begin(output) + 3), 3);
+    for (auto i = 0u; i < 3u; ++i)
+        ASSERT_EQ(output[i], std::to_string(i));
+    ASSERT_EQ(queue.popRange(std::begin(output), std::begin(output) + queueSize), 5);
+    for (auto i = 3u; i < 6u; ++i)
+        ASSERT_EQ(output[i - 3], std::to_string(i));
+    ASSERT_EQ(output[3], "0");
+    ASSERT_EQ(output[4], "1");
+    ASSERT_EQ(queue.popRange(std::begin(output), std::begin(output) + queueSize), 0);
+}
+
+TEST(MPMCQueue, RangeThreading)
+{
+    constexpr std::size_t ThreadCount = 4;
+    static constexpr std::size_t Counter = 4096 * ThreadCount;
+    static constexpr std::size_t BatchSize = 8;
+
+    Core::MPMCQueue<std::size_t> queue(64);
+    std::atomic<std::size_t> popCount { 0 };
+    std::atomic<std::size_t> popSum { 0 };
+    std::vector<std::thread> thds;
+
+    for (auto i = 0ul; i < ThreadCount; ++i) {
+        thds.emplace_back([&queue, i] {
+            std::size_t values[BatchSize];
+            for (auto value = i * (Counter / ThreadCount), end = value + Counter / ThreadCount; value != end;) {
+                const auto count = std::min(BatchSize, end - value);
+                std::iota(values, values + count, value);
+                if (const auto pushed = queue.pushRange(values, values + count); pushed)
+                    value += pushed;
+                else
+                    std::this_thread::yield();
+            }
+        });
+        thds.emplace_back([&queue, &popCount, &popSum] {
+            std::size_t values[BatchSize];
+            while (popCount != Counter) {
+                const auto count = queue.popRange(values, values + BatchSize);
+                if (!count)
+                    std::this_thread::yield();
+                popSum += std::accumulate(values, values + count, 0ul);
+                popCount += count;
+            }
+        });
+    }
+    for (auto &thd : thds)
+        thd.join();
+    ASSERT_EQ(popSum, Counter * (Counter - 1) / 2);
+}
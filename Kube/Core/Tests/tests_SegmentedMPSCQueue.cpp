@@ -0,0 +1,103 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the segmented MPSC Queue
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/SegmentedMPSCQueue.hpp>
+
+using namespace kF;
+
+/** @brief Static allocator counting its live allocations */
+struct CountingAllocator
+{
+    static inline std::size_t LiveCount {};
+
+    [[nodiscard]] static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { ++LiveCount; return Core::DefaultStaticAllocator::Allocate(bytes, alignment); }
+
+    static void Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+        { --LiveCount; Core::DefaultStaticAllocator::Deallocate(data, bytes, alignment); }
+};
+
+TEST(SegmentedMPSCQueue, SinglePushPop)
+{
+    constexpr std::size_t count = 100;
+
+    Core::SegmentedMPSCQueue<std::string, Core::DefaultStaticAllocator, 4> queue;
+
+    // Run twice to reuse recycled segments
+    for (auto pass = 0u; pass < 2u; ++pass) {
+        for (auto i = 0u; i < count; ++i)
+            ASSERT_TRUE(queue.push(std::to_string(i)));
+        for (auto i = 0u; i < count; ++i) {
+            std::string str;
+            ASSERT_TRUE(queue.pop(str));
+            ASSERT_EQ(str, std::to_string(i));
+        }
+        std::string str;
+        ASSERT_FALSE(queue.pop(str));
+    }
+    // Leave elements to be destroyed by the queue
+    for (auto i = 0u; i < count; ++i)
+        ASSERT_TRUE(queue.push(std::to_string(i)));
+}
+
+TEST(SegmentedMPSCQueue, MultipleProducers)
+{
+    constexpr std::size_t producerCount = 4;
+    constexpr std::size_t count = 50000;
+
+    Core::SegmentedMPSCQueue<std::size_t, Core::DefaultStaticAllocator, 8> queue;
+    std::vector<std::thread> producers;
+
+    for (auto producer = 0ul; producer < producerCount; ++producer) {
+        producers.emplace_back([&queue, producer] {
+            for (auto i = 0ul; i < count; ++i)
+                queue.push(producer * count + i);
+        });
+    }
+
+    // Elements of a single producer must be received in order
+    std::vector<std::size_t> next(producerCount);
+    for (auto received = 0ul; received < producerCount * count;) {
+        std::size_t value {};
+        if (!queue.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto producer = value / count;
+        ASSERT_EQ(value % count, next[producer]);
+        ++next[producer];
+        ++received;
+    }
+    for (auto &thd : producers)
+        thd.join();
+    std::size_t value {};
+    ASSERT_FALSE(queue.pop(value));
+}
+
+TEST(SegmentedMPSCQueue, BoundedFreeList)
+{
+    constexpr std::size_t count = 100;
+    constexpr std::size_t maxFreeSegmentCount = 2;
+
+    {
+        Core::SegmentedMPSCQueue<std::size_t, CountingAllocator, 4, maxFreeSegmentCount> queue;
+
+        for (auto i = 0ul; i < count; ++i)
+            ASSERT_TRUE(queue.push(i));
+        ASSERT_GE(CountingAllocator::LiveCount, count / 4);
+        for (auto i = 0ul; i < count; ++i) {
+            std::size_t value {};
+            ASSERT_TRUE(queue.pop(value));
+            ASSERT_EQ(value, i);
+        }
+        // Only the head segment, its successor and recycled segments remain allocated
+        ASSERT_LE(CountingAllocator::LiveCount, maxFreeSegmentCount + 2);
+    }
+    ASSERT_EQ(CountingAllocator::LiveCount, 0);
+}
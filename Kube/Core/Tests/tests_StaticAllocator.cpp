@@ -21,4 +21,33 @@ TEST(StaticAllocator, StaticUnsafeAllocator)
     auto ptr = StaticUnsafeAllocator::Allocate(42, 16);
     ASSERT_NE(ptr, nullptr);
     StaticUnsafeAllocator::Deallocate(ptr, 64, 16);
-}
\ No newline at end of file
+}
+TEST(StaticAllocator, Batch)
+{
+    using StaticUnsafeAllocator = Core::StaticAllocator<Core::UnsafeAllocator<>, "TestStaticUnsafeAllocatorBatch">;
+
+    void *ptrs[16] {};
+    ASSERT_TRUE(StaticUnsafeAllocator::AllocateBatch(64, 16, 16, ptrs));
+    for (const auto ptr : ptrs)
+        ASSERT_NE(ptr, nullptr);
+    StaticUnsafeAllocator::DeallocateBatch(64, 16, 16, ptrs);
+}
+
+TEST(StaticAllocator, Stats)
+{
+    using StaticUnsafeAllocator = Core::StaticAllocator<Core::UnsafeAllocator<>, "TestStaticUnsafeAllocatorStats">;
+
+    auto ptr = StaticUnsafeAllocator::Allocate(32, 32);
+    Core::AllocatorStats stats;
+    ASSERT_EQ(StaticUnsafeAllocator::Stats(stats), Core::AllocatorStatsEnabled);
+
+    Core::AllocatorStats namedStats;
+    const bool found = Core::AllocatorUtils::QueryAllocatorStats("TestStaticUnsafeAllocatorStats", namedStats);
+    if constexpr (Core::AllocatorStatsEnabled) {
+        ASSERT_TRUE(found);
+        ASSERT_EQ(namedStats.buckets[0].live, 1);
+        ASSERT_EQ(stats.buckets[0].live, 1);
+    } else
+        ASSERT_FALSE(found);
+    StaticUnsafeAllocator::Deallocate(ptr, 32, 32);
+}
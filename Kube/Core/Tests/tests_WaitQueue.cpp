@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the wait queue
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/MPMCQueue.hpp>
+#include <Kube/Core/SPSCQueue.hpp>
+#include <Kube/Core/WaitQueue.hpp>
+
+using namespace kF;
+
+TEST(WaitQueue, TryPushPop)
+{
+    constexpr std::size_t queueSize = 4;
+
+    Core::WaitQueue<Core::MPMCQueue<int>> queue(queueSize);
+
+    for (auto i = 0; i < static_cast<int>(queueSize); ++i)
+        ASSERT_TRUE(queue.push(i));
+    ASSERT_FALSE(queue.push(42));
+    ASSERT_EQ(queue.size(), queueSize);
+    for (auto i = 0; i < static_cast<int>(queueSize); ++i) {
+        int value {};
+        ASSERT_TRUE(queue.popWait(value));
+        ASSERT_EQ(value, i);
+    }
+    int value {};
+    ASSERT_FALSE(queue.pop(value));
+}
+
+template<typename Queue>
+static void ProducerConsumer(void) noexcept
+{
+    constexpr std::size_t queueSize = 4;
+    constexpr std::size_t count = 100000;
+
+    Core::WaitQueue<Queue, 8> queue(queueSize);
+    std::thread producer([&queue] {
+        for (auto i = 0ul; i < count; ++i)
+            ASSERT_TRUE(queue.pushWait(i));
+    });
+    std::size_t sum {};
+    for (auto i = 0ul; i < count; ++i) {
+        std::size_t value {};
+        ASSERT_TRUE(queue.popWait(value));
+        ASSERT_EQ(value, i);
+        sum += value;
+    }
+    producer.join();
+    ASSERT_EQ(sum, count * (count - 1) / 2);
+}
+
+TEST(WaitQueue, ProducerConsumerMPMC)
+{
+    ProducerConsumer<Core::MPMCQueue<std::size_t>>();
+}
+
+TEST(WaitQueue, ProducerConsumerSPSC)
+{
+    ProducerConsumer<Core::SPSCQueue<std::size_t>>();
+}
+
+TEST(WaitQueue, Close)
+{
+    Core::WaitQueue<Core::MPMCQueue<int>> queue(2);
+
+    std::thread consumer([&queue] {
+        int value {};
+        ASSERT_FALSE(queue.popWait(value));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.close();
+    consumer.join();
+    ASSERT_TRUE(queue.closed());
+
+    // Non-waiting operations still work once closed
+    ASSERT_TRUE(queue.push(1));
+    ASSERT_TRUE(queue.push(2));
+    ASSERT_FALSE(queue.pushWait(3));
+    int value {};
+    ASSERT_TRUE(queue.popWait(value));
+    ASSERT_EQ(value, 1);
+}
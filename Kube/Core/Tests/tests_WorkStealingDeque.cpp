@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the work stealing deque
+ */
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/WorkStealingDeque.hpp>
+
+using namespace kF;
+
+TEST(WorkStealingDeque, Basics)
+{
+    constexpr std::size_t capacity = 8;
+
+    Core::WorkStealingDeque<std::size_t> deque(capacity);
+    std::size_t values[capacity + 2];
+    std::iota(std::begin(values), std::end(values), 0ul);
+
+    ASSERT_EQ(deque.capacity(), capacity);
+    ASSERT_EQ(deque.pushRange(std::begin(values), std::end(values)), capacity);
+    ASSERT_FALSE(deque.push(42ul));
+    ASSERT_EQ(deque.size(), capacity);
+
+    // Owner pops newest first, thieves steal oldest first
+    std::size_t value {};
+    ASSERT_TRUE(deque.pop(value));
+    ASSERT_EQ(value, capacity - 1);
+    ASSERT_TRUE(deque.steal(value));
+    ASSERT_EQ(value, 0ul);
+    ASSERT_TRUE(deque.push(42ul));
+    ASSERT_TRUE(deque.pop(value));
+    ASSERT_EQ(value, 42ul);
+    for (auto i = 1ul; i < capacity - 1; ++i) {
+        ASSERT_TRUE(deque.steal(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(deque.steal(value));
+    ASSERT_FALSE(deque.pop(value));
+    ASSERT_EQ(deque.size(), 0ul);
+}
+
+TEST(WorkStealingDeque, Threading)
+{
+    constexpr std::size_t thiefCount = 3;
+    constexpr std::size_t count = 20000;
+
+    Core::WorkStealingDeque<std::size_t> deque(64);
+    std::vector<std::atomic<std::uint8_t>> received(count);
+    std::atomic<std::size_t> receivedCount { 0 };
+    std::vector<std::thread> thieves;
+
+    for (auto i = 0ul; i < thiefCount; ++i) {
+        thieves.emplace_back([&] {
+            std::size_t value {};
+            while (receivedCount.load() != count) {
+                if (deque.steal(value)) {
+                    ++received[value];
+                    ++receivedCount;
+                } else
+                    std::this_thread::yield();
+            }
+        });
+    }
+    // Owner pushes then pops half of the time
+    std::size_t value {};
+    for (auto i = 0ul; i < count;) {
+        if (deque.push(i))
+            ++i;
+        if ((i & 1) && deque.pop(value)) {
+            ++received[value];
+            ++receivedCount;
+        }
+    }
+    while (deque.pop(value)) {
+        ++received[value];
+        ++receivedCount;
+    }
+    for (auto &thief : thieves)
+        thief.join();
+    for (auto &flag : received)
+        ASSERT_EQ(flag.load(), 1);
+}
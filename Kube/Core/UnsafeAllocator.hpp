@@ -9,6 +9,7 @@
 
 #include "IAllocator.hpp"
 #include "AllocatorUtils.hpp"
+#include "AllocatorStats.hpp"
 
 namespace kF::Core
 {
@@ -104,10 +105,22 @@ public:
     void deallocate(void * const data, const std::size_t size, const std::size_t alignment) noexcept override;
 
 
+    /** @brief Batch allocate function implementation */
+    [[nodiscard]] bool allocateBatch(const std::size_t size, const std::size_t alignment, const std::size_t count, void ** const out) noexcept override;
+
+    /** @brief Batch deallocate function implementation */
+    void deallocateBatch(const std::size_t size, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept override;
+
+
     /** @brief Check if the allocator still has allocations
      *  @note This function is slow */
     [[nodiscard]] bool empty(void) noexcept;
 
+
+    /** @brief Get a snapshot of allocator statistics
+     *  @note Statistics are empty unless KUBE_ALLOCATOR_STATS is enabled */
+    inline void stats(AllocatorStats &out) const noexcept { _stats.snapshot(out); }
+
 private:
     /** @brief Allocate data from a specific bucket */
     [[nodiscard]] void *allocateFromBucket(const std::size_t bucketIndex) noexcept;
@@ -138,6 +151,7 @@ private:
     AllocatorUtils::UnsafeStackMetaData *_stack {}; // Only 1 stack is used at a time
     AllocatorUtils::UnsafeStackMetaData *_busyStack {};
     std::array<AllocatorUtils::AllocationHeader *, BucketCount> _buckets {};
+    [[no_unique_address]] AllocatorUtils::StatsCounters<MinSizePower, BucketCount, false> _stats {};
 };
 
 #include "UnsafeAllocator.ipp"
\ No newline at end of file
@@ -32,10 +32,13 @@ inline void *kF::Core::UnsafeAllocator<MinSizePower, MaxSizePower, MaxStackSizeP
     // If the size fits into the maximum size a bucket can hold, look for existing buckets
     if (const auto targetSize = std::max(size, alignment); targetSize <= MaxSize) [[likely]] {
         // Find perfect bucket fit index
-        data = allocateFromBucket(AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize));
+        const auto bucketIndex = AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize);
+        data = allocateFromBucket(bucketIndex);
+        _stats.onAllocate(bucketIndex, 1u);
     // The required size is out of buckets retention range
     } else [[unlikely]] {
         data = AllocatorUtils::FallbackAllocate(size, alignment);
+        _stats.onFallbackAllocate(size);
     }
 
     return data;
@@ -48,13 +51,72 @@ inline void kF::Core::UnsafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePo
     auto targetSize = std::max(size, alignment);
     // If the size is retainable, insert it into a bucket
     if (data && targetSize <= MaxSize) [[likely]] {
-        deallocateFromBucket(data, AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize));
+        const auto bucketIndex = AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize);
+        deallocateFromBucket(data, bucketIndex);
+        _stats.onDeallocate(bucketIndex, 1u);
     // Else deallocate it
     } else [[unlikely]] {
+        if (data)
+            _stats.onFallbackDeallocate(size);
         AllocatorUtils::FallbackDeallocate(data, size, alignment);
     }
 }
 
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
+inline bool kF::Core::UnsafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::allocateBatch(
+        const std::size_t size, const std::size_t alignment, const std::size_t count, void ** const out) noexcept
+{
+    const auto targetSize = std::max(size, alignment);
+
+    // The required size is out of buckets retention range
+    if (targetSize > MaxSize) [[unlikely]]
+        return AllocatorUtils::FallbackAllocateBatch(*this, size, alignment, count, out);
+
+    const auto bucketIndex = AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize);
+    auto &bucket = _buckets[bucketIndex];
+    std::size_t index = 0u;
+
+    // Pop from bucket as long as possible
+    for (; index != count && bucket; ++index) {
+        out[index] = reinterpret_cast<void *>(bucket);
+        bucket = bucket->next;
+    }
+
+    // Allocate what is left from stack
+    const auto bucketSize = static_cast<std::size_t>(1u) << (bucketIndex + MinSizePower);
+    for (; index != count; ++index) {
+        out[index] = allocateFromStack(bucketSize);
+        if (!out[index]) [[unlikely]] {
+            _stats.onAllocate(bucketIndex, index);
+            deallocateBatch(size, alignment, index, out);
+            return false;
+        }
+    }
+    _stats.onAllocate(bucketIndex, count);
+    return true;
+}
+
+template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
+inline void kF::Core::UnsafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::deallocateBatch(
+        const std::size_t size, const std::size_t alignment, const std::size_t count, void * const * const data) noexcept
+{
+    const auto targetSize = std::max(size, alignment);
+
+    // The size is out of buckets retention range
+    if (targetSize > MaxSize) [[unlikely]]
+        return AllocatorUtils::FallbackDeallocateBatch(*this, size, alignment, count, data);
+    else if (!count) [[unlikely]]
+        return;
+
+    // Insert the whole chain in front of the bucket
+    const auto bucketIndex = AllocatorUtils::GetBucketIndex<MinSizePower>(targetSize);
+    auto &bucket = _buckets[bucketIndex];
+    _stats.onDeallocate(bucketIndex, count);
+    const auto tail = AllocatorUtils::LinkAllocationChain(data, count);
+    tail->next = bucket;
+    bucket = reinterpret_cast<AllocatorUtils::AllocationHeader *>(data[0]);
+}
+
 template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStackSizePower>
 inline void *kF::Core::UnsafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::allocateFromBucket(
         const std::size_t bucketIndex) noexcept
@@ -131,6 +193,7 @@ inline bool kF::Core::UnsafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePo
     const auto data = AllocatorUtils::FallbackAllocate(stackSize, _pageSize);
 
     if (data) [[likely]] {
+        _stats.onStack(stackSize);
         _stack = new (data) AllocatorUtils::UnsafeStackMetaData {
             .size = stackSize,
             .next = nullptr
@@ -146,6 +209,7 @@ template<std::size_t MinSizePower, std::size_t MaxSizePower, std::size_t MaxStac
 inline void kF::Core::UnsafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePower>::fragmentStack(void) noexcept
 {
     // Fragment all available stack size
+    _stats.onFragmentation();
     fragmentStackBlock(_tail - _head);
 
     // Insert the stack in busy list
@@ -175,6 +239,7 @@ inline void kF::Core::UnsafeAllocator<MinSizePower, MaxSizePower, MaxStackSizePo
             auto &bucket = _buckets[blockPower - MinSizePower];
             blockPtr->next = bucket;
             bucket = blockPtr;
+            _stats.onFragmentedBlock(blockPower - MinSizePower);
         }
 
         // Reduce available size by fragmented block size
@@ -16,6 +16,10 @@
 
 #include "Platform.hpp"
 
+#if KUBE_COMPILER_MSVC
+# include <intrin.h>
+#endif
+
 /** @brief Helper used to pass template into macro */
 #define TEMPLATE_TYPE(Class, ...) decltype(std::declval<Class<__VA_ARGS__>>())
 
@@ -130,6 +134,20 @@ namespace kF::Core
     inline void AlignedFree(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
         { ::operator delete(data, bytes, static_cast<std::align_val_t>(alignment)); }
 
+    /** @brief Hint the processor that the calling thread is busy waiting */
+    inline void CpuRelax(void) noexcept
+    {
+#if KUBE_ARCH_AMD64 && (KUBE_COMPILER_GCC | KUBE_COMPILER_CLANG)
+        __builtin_ia32_pause();
+#elif KUBE_ARCH_ARM64 && (KUBE_COMPILER_GCC | KUBE_COMPILER_CLANG)
+        asm volatile("yield");
+#elif KUBE_ARCH_AMD64 && KUBE_COMPILER_MSVC
+        _mm_pause();
+#elif KUBE_ARCH_ARM64 && KUBE_COMPILER_MSVC
+        __yield();
+#endif
+    }
+
 
     /** @brief Concept of an allocator */
     template<typename Type>
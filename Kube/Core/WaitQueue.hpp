@@ -0,0 +1,115 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Wait capable queue wrapper
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    template<typename Queue, std::size_t SpinCount>
+    class WaitQueue;
+}
+
+/**
+ * @brief The wait queue wraps any Core queue (MPMC, MPSC, SPSC, SPMC) to add blocking push / pop
+ * Waiting threads first spin 'SpinCount' times then park on an atomic epoch (futex on Linux)
+ * Non-waiting operations only pay a fence and a load to check if a thread needs to be woken up
+ *
+ * @tparam Queue Queue type to wrap
+ * @tparam SpinCount Number of try before parking
+ */
+template<typename Queue, std::size_t SpinCount = 64>
+class alignas_double_cacheline kF::Core::WaitQueue
+{
+public:
+    /** @brief Epoch type used to park threads */
+    using Epoch = std::uint32_t;
+
+
+    /** @brief Construct the underlying queue */
+    template<typename ...QueueArgs>
+    WaitQueue(QueueArgs &&...args) noexcept : _queue(std::forward<QueueArgs>(args)...) {}
+
+
+    /** @brief Get the underlying queue
+     *  @note Operations done directly on the queue don't wake up waiting threads */
+    [[nodiscard]] inline Queue &queue(void) noexcept { return _queue; }
+    [[nodiscard]] inline const Queue &queue(void) const noexcept { return _queue; }
+
+    /** @brief Return the size of the queue */
+    [[nodiscard]] inline std::size_t size(void) const noexcept { return _queue.size(); }
+
+
+    /** @brief Try to push a single element into the queue, waking up a waiting consumer on success
+     *  @return true if the element has been inserted */
+    template<bool MoveOnSuccess = false, typename ...Args>
+    [[nodiscard]] bool push(Args &&...args) noexcept;
+
+    /** @brief Try to pop a single element from the queue, waking up a waiting producer on success
+     *  @return true if an element has been extracted */
+    template<typename Value>
+    [[nodiscard]] bool pop(Value &value) noexcept;
+
+
+    /** @brief Push up to 'count' elements into the queue, waking up waiting consumers on success
+     *  @return The number of inserted elements */
+    template<typename InputIterator>
+    [[nodiscard]] std::size_t pushRange(const InputIterator from, const InputIterator to) noexcept;
+
+    /** @brief Pop up to 'count' elements from the queue, waking up waiting producers on success
+     *  @return The number of extracted elements */
+    template<typename OutputIterator>
+    [[nodiscard]] std::size_t popRange(const OutputIterator from, const OutputIterator to) noexcept;
+
+
+    /** @brief Push a single element into the queue, waiting while the queue is full
+     *  @return false only if the queue has been closed while waiting */
+    template<bool MoveOnSuccess = false, typename ...Args>
+    [[nodiscard]] bool pushWait(Args &&...args) noexcept;
+
+    /** @brief Pop a single element from the queue, waiting while the queue is empty
+     *  @return false only if the queue has been closed while waiting */
+    template<typename Value>
+    [[nodiscard]] bool popWait(Value &value) noexcept;
+
+
+    /** @brief Close the queue, waking up every waiting thread
+     *  @note Non-waiting operations still work after close */
+    void close(void) noexcept;
+
+    /** @brief Re-open a closed queue */
+    inline void reopen(void) noexcept { _closed.store(false, std::memory_order_release); }
+
+    /** @brief Check if the queue is closed */
+    [[nodiscard]] inline bool closed(void) const noexcept { return _closed.load(std::memory_order_acquire); }
+
+
+    /** @brief Clear all elements of the queue (unsafe) */
+    inline void clear(void) noexcept { _queue.clear(); }
+
+private:
+    /** @brief Wake up waiting threads if any, a single one unless 'count' elements are available */
+    static inline void Notify(std::atomic<Epoch> &epoch, const std::atomic<Epoch> &waiters, const std::size_t count = 1) noexcept;
+
+    /** @brief Spin then park until 'function' succeeds or the queue is closed */
+    template<typename Function>
+    [[nodiscard]] inline bool waitFor(std::atomic<Epoch> &epoch, std::atomic<Epoch> &waiters, Function &&function) noexcept;
+
+
+    // Cacheline 0 - N
+    Queue _queue;
+    // Cacheline N + 1
+    alignas_cacheline std::atomic<Epoch> _pushEpoch {}; // Incremented by producers when consumers are waiting
+    std::atomic<Epoch> _consumerWaiters {};
+    // Cacheline N + 2
+    alignas_cacheline std::atomic<Epoch> _popEpoch {}; // Incremented by consumers when producers are waiting
+    std::atomic<Epoch> _producerWaiters {};
+    std::atomic<bool> _closed {};
+};
+
+#include "WaitQueue.ipp"
@@ -0,0 +1,113 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Wait capable queue wrapper
+ */
+
+template<typename Queue, std::size_t SpinCount>
+template<bool MoveOnSuccess, typename ...Args>
+inline bool kF::Core::WaitQueue<Queue, SpinCount>::push(Args &&...args) noexcept
+{
+    if (!_queue.template push<MoveOnSuccess>(std::forward<Args>(args)...)) [[unlikely]]
+        return false;
+    Notify(_pushEpoch, _consumerWaiters);
+    return true;
+}
+
+template<typename Queue, std::size_t SpinCount>
+template<typename Value>
+inline bool kF::Core::WaitQueue<Queue, SpinCount>::pop(Value &value) noexcept
+{
+    if (!_queue.pop(value))
+        return false;
+    Notify(_popEpoch, _producerWaiters);
+    return true;
+}
+
+template<typename Queue, std::size_t SpinCount>
+template<typename InputIterator>
+inline std::size_t kF::Core::WaitQueue<Queue, SpinCount>::pushRange(const InputIterator from, const InputIterator to) noexcept
+{
+    const auto count = _queue.pushRange(from, to);
+    if (count) [[likely]]
+        Notify(_pushEpoch, _consumerWaiters, count);
+    return count;
+}
+
+template<typename Queue, std::size_t SpinCount>
+template<typename OutputIterator>
+inline std::size_t kF::Core::WaitQueue<Queue, SpinCount>::popRange(const OutputIterator from, const OutputIterator to) noexcept
+{
+    const auto count = _queue.popRange(from, to);
+    if (count) [[likely]]
+        Notify(_popEpoch, _producerWaiters, count);
+    return count;
+}
+
+template<typename Queue, std::size_t SpinCount>
+template<bool MoveOnSuccess, typename ...Args>
+inline bool kF::Core::WaitQueue<Queue, SpinCount>::pushWait(Args &&...args) noexcept
+{
+    // Arguments are only consumed on success so they can be forwarded at each try
+    return waitFor(_popEpoch, _producerWaiters, [this, &args...] {
+        return push<MoveOnSuccess>(std::forward<Args>(args)...);
+    });
+}
+
+template<typename Queue, std::size_t SpinCount>
+template<typename Value>
+inline bool kF::Core::WaitQueue<Queue, SpinCount>::popWait(Value &value) noexcept
+{
+    return waitFor(_pushEpoch, _consumerWaiters, [this, &value] {
+        return pop(value);
+    });
+}
+
+template<typename Queue, std::size_t SpinCount>
+inline void kF::Core::WaitQueue<Queue, SpinCount>::close(void) noexcept
+{
+    _closed.store(true, std::memory_order_seq_cst);
+    _pushEpoch.fetch_add(1, std::memory_order_seq_cst);
+    _pushEpoch.notify_all();
+    _popEpoch.fetch_add(1, std::memory_order_seq_cst);
+    _popEpoch.notify_all();
+}
+
+template<typename Queue, std::size_t SpinCount>
+inline void kF::Core::WaitQueue<Queue, SpinCount>::Notify(std::atomic<Epoch> &epoch, const std::atomic<Epoch> &waiters, const std::size_t count) noexcept
+{
+    // Pairs with the fence of 'waitFor': either the waiter is seen or the waiter sees our operation
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_relaxed)) [[unlikely]] {
+        epoch.fetch_add(1, std::memory_order_release);
+        if (count == 1)
+            epoch.notify_one();
+        else
+            epoch.notify_all();
+    }
+}
+
+template<typename Queue, std::size_t SpinCount>
+template<typename Function>
+inline bool kF::Core::WaitQueue<Queue, SpinCount>::waitFor(std::atomic<Epoch> &epoch, std::atomic<Epoch> &waiters, Function &&function) noexcept
+{
+    // Spin phase
+    for (std::size_t i = 0; i != SpinCount; ++i) {
+        if (function()) [[likely]]
+            return true;
+        CpuRelax();
+    }
+
+    // Park phase
+    while (true) {
+        waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto current = epoch.load(std::memory_order_acquire);
+        const bool success = function();
+        if (success || _closed.load(std::memory_order_acquire)) [[likely]] {
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+            return success;
+        }
+        epoch.wait(current, std::memory_order_acquire);
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
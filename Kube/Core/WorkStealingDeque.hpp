@@ -0,0 +1,90 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Work stealing deque
+ */
+
+#pragma once
+
+#include <atomic>
+#include <iterator>
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+    class WorkStealingDeque;
+}
+
+/**
+ * @brief Bounded Chase-Lev work stealing deque
+ * The owner thread pushes and pops at the bottom (LIFO, best cache locality)
+ * Any other thread can steal at the top (FIFO, oldest and usually largest work first)
+ *
+ * @tparam Type Trivially copyable type to be inserted
+ * @tparam Allocator Static allocator
+ */
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+class alignas_double_cacheline kF::Core::WorkStealingDeque
+{
+public:
+    static_assert(std::is_trivially_copyable_v<Type>, "Core::WorkStealingDeque: Type must be trivially copyable");
+
+    /** @brief Signed index type, the owner can temporarily move bottom below top */
+    using Index = std::int64_t;
+
+    /** @brief Buffer structure containing all cells, cells are atomic as thieves may read a cell being overwritten */
+    struct Buffer
+    {
+        std::atomic<Type> *data {};
+        Index mask {};
+    };
+
+
+    /** @brief Destruct and release all memory */
+    ~WorkStealingDeque(void) noexcept;
+
+    /** @brief Initialize the deque, capacity is rounded up to the next power of 2 */
+    WorkStealingDeque(const std::size_t capacity) noexcept;
+
+
+    /** @brief Get the approximative size of the deque */
+    [[nodiscard]] std::size_t size(void) const noexcept;
+
+    /** @brief Get the capacity of the deque */
+    [[nodiscard]] inline std::size_t capacity(void) const noexcept { return static_cast<std::size_t>(_buffer.mask + 1); }
+
+
+    /** @brief Push a single element at the bottom (owner only)
+     *  @return true if the element has been inserted */
+    [[nodiscard]] bool push(const Type value) noexcept;
+
+    /** @brief Push up to 'count' elements at the bottom (owner only)
+     *  @return The number of inserted elements */
+    template<std::input_iterator InputIterator>
+    [[nodiscard]] std::size_t pushRange(const InputIterator from, const InputIterator to) noexcept;
+
+
+    /** @brief Pop the last pushed element (owner only)
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool pop(Type &value) noexcept;
+
+    /** @brief Steal the oldest element (any thread)
+     *  @return true if an element has been extracted, false if empty or if another thread won the race */
+    [[nodiscard]] bool steal(Type &value) noexcept;
+
+
+private:
+    // Cacheline 0 -> 1
+    alignas_double_cacheline std::atomic<Index> _top { 0 }; // Top accessed by thieves and owner
+    // Cacheline 2 -> 3
+    alignas_double_cacheline std::atomic<Index> _bottom { 0 }; // Bottom modified by owner
+    Buffer _buffer {};
+
+
+    /** @brief Copy and move constructors disabled */
+    WorkStealingDeque(const WorkStealingDeque &other) = delete;
+    WorkStealingDeque(WorkStealingDeque &&other) = delete;
+};
+
+#include "WorkStealingDeque.ipp"
@@ -0,0 +1,112 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Work stealing deque
+ */
+
+#include <bit>
+
+#include "Abort.hpp"
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::Core::WorkStealingDeque<Type, Allocator>::~WorkStealingDeque(void) noexcept
+{
+    Allocator::Deallocate(_buffer.data, sizeof(std::atomic<Type>) * capacity(), alignof(std::atomic<Type>));
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::Core::WorkStealingDeque<Type, Allocator>::WorkStealingDeque(const std::size_t capacity) noexcept
+{
+    const auto realCapacity = std::bit_ceil(std::max<std::size_t>(capacity, 2));
+
+    _buffer.mask = static_cast<Index>(realCapacity - 1);
+    _buffer.data = reinterpret_cast<std::atomic<Type> *>(Allocator::Allocate(sizeof(std::atomic<Type>) * realCapacity, alignof(std::atomic<Type>)));
+    kFEnsure(_buffer.data, "Core::WorkStealingDeque: Allocation of capacity ", realCapacity, " failed");
+    for (std::size_t i = 0; i != realCapacity; ++i)
+        new (_buffer.data + i) std::atomic<Type> {};
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline std::size_t kF::Core::WorkStealingDeque<Type, Allocator>::size(void) const noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_relaxed);
+
+    return static_cast<std::size_t>(std::max<Index>(bottom - top, 0));
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::WorkStealingDeque<Type, Allocator>::push(const Type value) noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_acquire);
+
+    if (bottom - top > _buffer.mask) [[unlikely]]
+        return false;
+    _buffer.data[bottom & _buffer.mask].store(value, std::memory_order_relaxed);
+    // Publish the element before thieves can observe the new bottom
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+template<std::input_iterator InputIterator>
+inline std::size_t kF::Core::WorkStealingDeque<Type, Allocator>::pushRange(const InputIterator from, const InputIterator to) noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_acquire);
+    const auto available = _buffer.mask + 1 - (bottom - top);
+    const auto count = std::min<Index>(available, static_cast<Index>(std::distance(from, to)));
+
+    if (count <= 0) [[unlikely]]
+        return 0;
+    auto it = from;
+    for (Index i = 0; i != count; ++i, ++it)
+        _buffer.data[(bottom + i) & _buffer.mask].store(*it, std::memory_order_relaxed);
+    // Publish every element at once
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(bottom + count, std::memory_order_relaxed);
+    return static_cast<std::size_t>(count);
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::WorkStealingDeque<Type, Allocator>::pop(Type &value) noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+
+    // Reserve the bottom element before reading top, thieves that did not see the reservation compete on top
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = _top.load(std::memory_order_relaxed);
+
+    // Deque is empty, restore bottom
+    if (top > bottom) [[unlikely]] {
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+    value = _buffer.data[bottom & _buffer.mask].load(std::memory_order_relaxed);
+    // More than one element, no thief can reach this one
+    if (top != bottom) [[likely]]
+        return true;
+    // Last element, race against thieves
+    const bool success = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return success;
+}
+
+template<typename Type, kF::Core::StaticAllocatorRequirements Allocator>
+inline bool kF::Core::WorkStealingDeque<Type, Allocator>::steal(Type &value) noexcept
+{
+    auto top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+        return false;
+    // Read before claiming, the cell can't be overwritten until top moves
+    const auto tmp = _buffer.data[top & _buffer.mask].load(std::memory_order_relaxed);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+    value = tmp;
+    return true;
+}
@@ -62,6 +62,10 @@ ECS::EntityRange ECS::Internal::ASystem::addRange(const Entity count) noexcept
 
 void ECS::Internal::ASystem::remove(const Entity entity) noexcept
 {
+    // Invalidate versioned handles
+    if (entity < _generations.size()) [[unlikely]]
+        ++_generations.at(entity);
+
     if (entity == _lastEntity) [[likely]]
         --_lastEntity;
     else {
@@ -80,6 +84,10 @@ void ECS::Internal::ASystem::remove(const Entity entity) noexcept
 
 void ECS::Internal::ASystem::removeRange(const EntityRange range) noexcept
 {
+    // Invalidate versioned handles
+    for (auto entity = range.begin, end = std::min(range.end, _generations.size()); entity < end; ++entity)
+        ++_generations.at(entity);
+
     if (range.end - 1 == _lastEntity) [[likely]]
         _lastEntity = range.begin - 1;
     else {
@@ -96,6 +104,30 @@ void ECS::Internal::ASystem::removeRange(const EntityRange range) noexcept
     }
 }
 
+bool ECS::Internal::ASystem::isAlive(const Entity entity) const noexcept
+{
+    // Entities start at 1 and NullEntity is always greater than the last entity
+    if (!entity || entity > _lastEntity) [[unlikely]]
+        return false;
+    for (const auto &freeRange : _freeEntities) {
+        if (entity >= freeRange.begin && entity < freeRange.end) [[unlikely]]
+            return false;
+    }
+    return true;
+}
+
+ECS::VersionedEntity ECS::Internal::ASystem::versioned(const Entity entity) noexcept
+{
+    // A removed entity has no generation to stamp, its handle would be valid until the entity is recycled
+    if (!isAlive(entity)) [[unlikely]]
+        return NullVersionedEntity;
+
+    // Start tracking generations of entity
+    if (entity >= _generations.size()) [[unlikely]]
+        _generations.insertFill(_generations.end(), entity + 1 - _generations.size(), EntityGeneration {});
+    return VersionedEntity { .entity = entity, .generation = _generations.at(entity) };
+}
+
 void ECS::Internal::ASystem::queryPipelineIndex(const Core::HashedName pipelineHash) noexcept
 {
     const auto expected = parent().getPipelineIndex(pipelineHash);
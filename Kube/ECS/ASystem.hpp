@@ -6,6 +6,7 @@
 #pragma once
 
 #include <Kube/Core/Expected.hpp>
+#include <Kube/Core/FlatVector.hpp>
 #include <Kube/Core/Hash.hpp>
 #include <Kube/Flow/Graph.hpp>
 
@@ -102,6 +103,19 @@ public:
     /** @brief Removes a range of entities */
     void removeRange(const EntityRange range) noexcept;
 
+
+    /** @brief Check if an entity is alive (created and not removed yet) */
+    [[nodiscard]] bool isAlive(const Entity entity) const noexcept;
+
+
+    /** @brief Get a versioned handle of an entity, returns NullVersionedEntity if the entity is not alive
+     *  @note Generations are only tracked for entities that had a versioned handle once */
+    [[nodiscard]] VersionedEntity versioned(const Entity entity) noexcept;
+
+    /** @brief Check if a versioned handle still refers to the same entity */
+    [[nodiscard]] inline bool isValid(const VersionedEntity handle) const noexcept
+        { return handle.entity < _generations.size() && _generations.at(handle.entity) == handle.generation; }
+
 protected:
     /** @brief Get pipeline index from pipeline runtime name */
     [[nodiscard]] Core::Expected<PipelineIndex> getPipelineIndex(const Core::HashedName pipelineHash) const noexcept;
@@ -136,7 +150,8 @@ private:
     std::int64_t _tickRate {};
     Flow::GraphPtr _graph {};
     Entity _lastEntity {};
-    Core::Vector<EntityRange, ECSAllocator> _freeEntities {};
+    Core::FlatVector<EntityRange, ECSAllocator> _freeEntities {};
+    Core::FlatVector<EntityGeneration, ECSAllocator> _generations {};
 };
 static_assert_alignof_cacheline(kF::ECS::Internal::ASystem);
 static_assert_sizeof_cacheline(kF::ECS::Internal::ASystem);
\ No newline at end of file
@@ -5,12 +5,14 @@
 
 #pragma once
 
+#include <Kube/Core/Hash.hpp>
 #include <Kube/Core/StaticSafeAllocator.hpp>
 
 namespace kF::ECS
 {
-    /** @brief Allocator of the ECS library */
-    struct ECSAllocator : Core::StaticSafeAllocator<"ECSAllocator"> {};
+    /** @brief Allocator of the ECS library
+     *  @note Events are allocated by the executor and released by workers, remote free lists keep this pattern local */
+    struct ECSAllocator : Core::StaticAllocator<Core::SafeAllocator<5, 12, 16, 64, Core::DefaultStackProvider, true>, "ECSAllocator"> {};
 
 
     /** @brief Entity */
@@ -43,6 +45,33 @@ namespace kF::ECS
         [[nodiscard]] constexpr EntityIndex size(void) const noexcept { return end - begin; }
     };
 
+    /** @brief Generation of an entity, incremented each time the entity is removed */
+    using EntityGeneration = std::uint32_t;
+
+    /** @brief Versioned entity handle, detects handles referring to a removed (and maybe recycled) entity */
+    struct alignas_eighth_cacheline VersionedEntity
+    {
+        Entity entity { NullEntity };
+        EntityGeneration generation {};
+
+        /** @brief Comparison operators */
+        [[nodiscard]] constexpr bool operator==(const VersionedEntity &other) const noexcept = default;
+        [[nodiscard]] constexpr bool operator!=(const VersionedEntity &other) const noexcept = default;
+
+        /** @brief Check if the handle is null */
+        [[nodiscard]] constexpr bool isNull(void) const noexcept { return entity == NullEntity; }
+    };
+
+    /** @brief Special null versioned entity */
+    static constexpr VersionedEntity NullVersionedEntity {};
+
+    /** @brief Sort order of component tables */
+    enum class SortOrder : bool
+    {
+        Ascending,
+        Descending
+    };
+
     /** @brief Number of bits in entity type */
     constexpr Entity EntityBitCount = sizeof(Entity) * 8;
 
@@ -56,5 +85,16 @@ namespace kF::ECS
         /** @brief Initializer of entity indexes */
         constexpr void EntityIndexInitializer(EntityIndex * const begin, EntityIndex * const end) noexcept
             { std::fill(begin, end, NullEntityIndex); }
+
+        /** @brief Compile-time hash of a component type, used to compare component accesses of systems */
+        template<typename Component>
+        [[nodiscard]] constexpr Core::HashedName ComponentHash(void) noexcept
+        {
+#if KUBE_COMPILER_MSVC
+            return Core::Hash(__FUNCSIG__);
+#else
+            return Core::Hash(__PRETTY_FUNCTION__);
+#endif
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of ComponentTable sort algorithms
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Random.hpp>
+#include <Kube/ECS/ComponentTable.hpp>
+
+using namespace kF;
+
+/** @brief Depth component, used as sort key */
+struct Depth
+{
+    std::uint32_t depth {};
+};
+
+/** @brief Component sorted by depth, similar to a painter area */
+struct Painter
+{
+    void *data[4] {};
+};
+
+/** @brief Component tables */
+using DepthTable = ECS::ComponentTable<Depth, 4096 / sizeof(ECS::Entity)>;
+using PainterTable = ECS::ComponentTable<Painter, 4096 / sizeof(ECS::Entity)>;
+
+/** @brief Setup tables with 'count' entities, shuffling depth of 'shuffleCount' pairs of entities
+ *  @note Local shuffles only swap neighbor entities, just like small tree modifications do */
+template<bool Local>
+static void SetupTables(DepthTable &depthTable, PainterTable &painterTable, const ECS::Entity count, const ECS::Entity shuffleCount) noexcept
+{
+    depthTable.clear();
+    painterTable.clear();
+    for (ECS::Entity entity = 1; entity <= count; ++entity) {
+        depthTable.add(entity, Depth { entity });
+        painterTable.add(entity);
+    }
+    for (ECS::Entity i {}; i != shuffleCount; ++i) {
+        const auto from = Core::Random::Generate32(count);
+        const auto to = Local ? std::min(from + 1 + Core::Random::Generate32(8), count - 1) : Core::Random::Generate32(count);
+        std::swap(depthTable.atIndex(from), depthTable.atIndex(to));
+    }
+}
+
+/** @brief Sort painter table by depth, either with a comparator or by key */
+template<bool ByKey, bool Local = false>
+static void SortPainters(benchmark::State &state, const ECS::Entity shuffleRatio) noexcept
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    DepthTable depthTable;
+    PainterTable painterTable;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        SetupTables<Local>(depthTable, painterTable, count, shuffleRatio ? count / shuffleRatio : 0);
+        state.ResumeTiming();
+        if constexpr (ByKey) {
+            painterTable.sortByKey([&depthTable](const ECS::Entity entity) { return depthTable.get(entity).depth; });
+        } else {
+            painterTable.sort([&depthTable](const ECS::Entity lhs, const ECS::Entity rhs) {
+                return depthTable.get(lhs).depth < depthTable.get(rhs).depth;
+            });
+        }
+        benchmark::DoNotOptimize(painterTable.entities().begin());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * count);
+}
+
+static void ECS_ComponentTable_Sort_Shuffled(benchmark::State &state) { SortPainters<false>(state, 1); }
+static void ECS_ComponentTable_SortByKey_Shuffled(benchmark::State &state) { SortPainters<true>(state, 1); }
+static void ECS_ComponentTable_Sort_NearlySorted(benchmark::State &state) { SortPainters<false>(state, 100); }
+static void ECS_ComponentTable_SortByKey_NearlySorted(benchmark::State &state) { SortPainters<true>(state, 100); }
+static void ECS_ComponentTable_Sort_LocallyShuffled(benchmark::State &state) { SortPainters<false, true>(state, 100); }
+static void ECS_ComponentTable_SortByKey_LocallyShuffled(benchmark::State &state) { SortPainters<true, true>(state, 100); }
+static void ECS_ComponentTable_Sort_Sorted(benchmark::State &state) { SortPainters<false>(state, 0); }
+static void ECS_ComponentTable_SortByKey_Sorted(benchmark::State &state) { SortPainters<true>(state, 0); }
+
+BENCHMARK(ECS_ComponentTable_Sort_Shuffled)->Arg(1024)->Arg(16384)->Arg(131072);
+BENCHMARK(ECS_ComponentTable_SortByKey_Shuffled)->Arg(1024)->Arg(16384)->Arg(131072);
+BENCHMARK(ECS_ComponentTable_Sort_NearlySorted)->Arg(1024)->Arg(16384)->Arg(131072);
+BENCHMARK(ECS_ComponentTable_SortByKey_NearlySorted)->Arg(1024)->Arg(16384)->Arg(131072);
+BENCHMARK(ECS_ComponentTable_Sort_LocallyShuffled)->Arg(1024)->Arg(16384)->Arg(131072);
+BENCHMARK(ECS_ComponentTable_SortByKey_LocallyShuffled)->Arg(1024)->Arg(16384)->Arg(131072);
+BENCHMARK(ECS_ComponentTable_Sort_Sorted)->Arg(1024)->Arg(16384)->Arg(131072);
+BENCHMARK(ECS_ComponentTable_SortByKey_Sorted)->Arg(1024)->Arg(16384)->Arg(131072);
@@ -47,6 +47,12 @@ public:
     /** @brief Component const reverse iterator */
     using ComponentConstReverseIterator = Components::ConstReverseIterator;
 
+    /** @brief 'sortByKey' uses insertion sort when at most 1 / NearlySortedRatio of the keys are out of order */
+    static constexpr EntityIndex NearlySortedRatio = 16;
+
+    /** @brief Number of insertion sort shifts allowed per component before falling back to radix sort */
+    static constexpr EntityIndex InsertionSortShiftBudget = 2;
+
     static_assert(IndexSparseSet::IsSafeToClear, "ECS::ComponentTable: There are no reason why index sparse set could not be safely cleared");
     static_assert(EntityPageSize != 0, "ECS::ComponentTable: Entity page size cannot be null");
 
@@ -135,11 +141,23 @@ public:
     [[nodiscard]] inline const auto &entities(void) const noexcept { return _entities; }
 
 
+    /** @brief Swap the positions of two components using their unstable index */
+    void swapIndexes(const EntityIndex lhs, const EntityIndex rhs) noexcept;
+
+
     /** @brief Sort the table using a custom functor
      *  @note CompareFunctor must have the following signature: bool(Entity, Entity) */
     template<typename CompareFunctor>
     void sort(CompareFunctor &&compareFunc) noexcept;
 
+    /** @brief Stable sort of the table using an integer key extracted once per component
+     *  @note KeyExtractor must have one of the following signatures: Key(Entity) | Key(const ComponentType &)
+     *  @note Nearly sorted tables use insertion sort, others use a LSD radix sort */
+    template<kF::ECS::SortOrder Order = kF::ECS::SortOrder::Ascending, typename KeyExtractor>
+        requires std::is_invocable_v<KeyExtractor, kF::ECS::Entity>
+            || std::is_invocable_v<KeyExtractor, const ComponentType &>
+    void sortByKey(KeyExtractor &&keyExtractor) noexcept;
+
 
     /** @brief Clear the table */
     void clear(void) noexcept;
@@ -3,6 +3,8 @@
  * @ Description: Pipeline
  */
 
+#include <array>
+
 #include <Kube/Core/SmallVector.hpp>
 
 #include "ComponentTable.hpp"
@@ -202,6 +204,19 @@ inline kF::ECS::EntityIndex kF::ECS::ComponentTable<ComponentType, EntityPageSiz
         return NullEntityIndex;
 }
 
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::swapIndexes(const EntityIndex lhs, const EntityIndex rhs) noexcept
+{
+    if (lhs == rhs) [[unlikely]]
+        return;
+    Entity &lhsEntity = _entities.at(lhs);
+    Entity &rhsEntity = _entities.at(rhs);
+    _indexSet.at(lhsEntity) = rhs;
+    _indexSet.at(rhsEntity) = lhs;
+    std::swap(lhsEntity, rhsEntity);
+    std::swap(atIndex(lhs), atIndex(rhs));
+}
+
 template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
 template<typename CompareFunctor>
 inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::sort(CompareFunctor &&compareFunc) noexcept
@@ -223,6 +238,126 @@ inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::s
     }
 }
 
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<kF::ECS::SortOrder Order, typename KeyExtractor>
+    requires std::is_invocable_v<KeyExtractor, kF::ECS::Entity>
+        || std::is_invocable_v<KeyExtractor, const ComponentType &>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::sortByKey(KeyExtractor &&keyExtractor) noexcept
+{
+    constexpr bool IsEntityKey = std::is_invocable_v<KeyExtractor, Entity>;
+    using Key = std::remove_cvref_t<typename std::conditional_t<IsEntityKey,
+        std::invoke_result<KeyExtractor, Entity>, std::invoke_result<KeyExtractor, const ComponentType &>>::type>;
+    static_assert(std::is_integral_v<Key>, "ECS::ComponentTable::sortByKey: Key must be an integer");
+    using UnsignedKey = std::make_unsigned_t<Key>;
+    constexpr std::size_t RadixBits = 8;
+    constexpr std::size_t RadixSize = 1ul << RadixBits;
+    constexpr std::size_t PassCount = sizeof(UnsignedKey);
+
+    struct KeyIndex
+    {
+        UnsignedKey key;
+        EntityIndex index;
+    };
+    using KeyIndexes = Core::Vector<KeyIndex, Allocator, EntityIndex>;
+
+    const auto count = _entities.size();
+    if (count < 2)
+        return;
+
+    // Extract keys once, mapped so that ascending unsigned order matches requested order
+    KeyIndexes keys;
+    keys.resizeUninitialized(count);
+    EntityIndex descents {};
+    for (EntityIndex index {}; index != count; ++index) {
+        UnsignedKey key;
+        if constexpr (IsEntityKey)
+            key = static_cast<UnsignedKey>(keyExtractor(_entities.at(index)));
+        else
+            key = static_cast<UnsignedKey>(keyExtractor(std::as_const(_components.at(index))));
+        if constexpr (std::is_signed_v<Key>)
+            key ^= static_cast<UnsignedKey>(UnsignedKey(1) << (sizeof(UnsignedKey) * 8 - 1));
+        if constexpr (Order == SortOrder::Descending)
+            key = static_cast<UnsignedKey>(~key);
+        keys.at(index) = KeyIndex { .key = key, .index = index };
+        descents += index && key < keys.at(index - 1).key;
+    }
+
+    // Already sorted
+    if (!descents)
+        return;
+
+    // Nearly sorted tables use insertion sort, until shift budget is exhausted
+    bool sorted = false;
+    if (descents <= count / NearlySortedRatio) {
+        auto budget = static_cast<std::size_t>(count) * InsertionSortShiftBudget;
+        sorted = true;
+        for (EntityIndex index = 1; sorted && index != count; ++index) {
+            const auto value = keys.at(index);
+            auto current = index;
+            while (current && value.key < keys.at(current - 1).key) {
+                keys.at(current) = keys.at(current - 1);
+                --current;
+                if (!--budget) [[unlikely]] {
+                    sorted = false;
+                    break;
+                }
+            }
+            keys.at(current) = value;
+        }
+    }
+
+    // LSD radix sort, skipping passes where every key share the same digit
+    KeyIndex *result = keys.begin();
+    KeyIndexes buffer;
+    if (!sorted) {
+        std::array<std::array<EntityIndex, RadixSize>, PassCount> histograms {};
+        for (const auto &keyIndex : keys) {
+            for (std::size_t pass {}; pass != PassCount; ++pass)
+                ++histograms[pass][(keyIndex.key >> (pass * RadixBits)) & (RadixSize - 1)];
+        }
+        buffer.resizeUninitialized(count);
+        KeyIndex *from = keys.begin();
+        KeyIndex *to = buffer.begin();
+        for (std::size_t pass {}; pass != PassCount; ++pass) {
+            const auto shift = pass * RadixBits;
+            auto &histogram = histograms[pass];
+            if (histogram[(from->key >> shift) & (RadixSize - 1)] == count)
+                continue;
+            EntityIndex offset {};
+            for (auto &bucket : histogram)
+                offset += std::exchange(bucket, offset);
+            for (EntityIndex index {}; index != count; ++index) {
+                const auto &keyIndex = from[index];
+                to[histogram[(keyIndex.key >> shift) & (RadixSize - 1)]++] = keyIndex;
+            }
+            std::swap(from, to);
+        }
+        result = from;
+    }
+
+    // Apply permutation to components, entities & sparse set by following cycles
+    for (EntityIndex index {}; index != count; ++index) {
+        if (result[index].index == index)
+            continue;
+        ComponentType component(std::move(_components.at(index)));
+        const auto entity = _entities.at(index);
+        auto current = index;
+        while (true) {
+            const auto next = std::exchange(result[current].index, current);
+            if (next == index) {
+                _components.at(current) = std::move(component);
+                _entities.at(current) = entity;
+                _indexSet.at(entity) = current;
+                break;
+            }
+            _components.at(current) = std::move(_components.at(next));
+            _entities.at(current) = _entities.at(next);
+            _indexSet.at(_entities.at(current)) = current;
+            current = next;
+        }
+    }
+}
+
 template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
 template<typename Callback>
     requires std::is_invocable_v<Callback, ComponentType &>
@@ -3,6 +3,7 @@
  * @ Description: System Scheduler
  */
 
+#include <algorithm>
 #include <chrono>
 #include <limits>
 #include <thread>
@@ -27,8 +28,9 @@ ECS::Executor::~Executor(void) noexcept
     _Instance = nullptr;
 }
 
-ECS::Executor::Executor(const std::size_t workerCount, const std::size_t taskQueueSize, const std::size_t eventQueueSize) noexcept
-    : _scheduler(workerCount, taskQueueSize), _eventQueue(eventQueueSize, false)
+ECS::Executor::Executor(const std::size_t workerCount, const std::size_t taskQueueSize, const std::size_t eventQueueSize,
+        const Flow::Scheduler::WorkerPlacement workerPlacement) noexcept
+    : _scheduler(workerCount, taskQueueSize, workerPlacement), _eventQueue(eventQueueSize, false)
 {
     kFEnsure(!_Instance,
         "ECS::Executor: Executor can only be instantiated once");
@@ -212,15 +214,21 @@ void ECS::Executor::buildPipelineGraph(const PipelineIndex pipelineIndex) noexce
 {
     // Retreive pipeline system list & graph
     auto &systems = _pipelines.systems.at(pipelineIndex);
+    auto &systemNames = _pipelines.systemHashes.at(pipelineIndex);
+    auto &systemAccesses = _pipelines.systemAccesses.at(pipelineIndex);
     auto &graph = *_pipelines.graphs.at(pipelineIndex);
 
-    // Clear old graph
+    // Clear old graph, names are null-terminated literals so they can be used by traces
     graph.clear();
+    graph.setName(_pipelines.names.at(pipelineIndex).data());
 
     // The first taks of the pipeline executes events and tells if the pipeline can execute
     auto &beginTask = graph.add([this, pipelineIndex] {
+        // Reset pipeline frame arena, previous tick temporaries are discarded
+        _pipelines.frameResets.at(pipelineIndex)();
+
         // Process all pipeline events
-        auto &queue = *_pipelines.events.at(pipelineIndex);
+        auto &queue = _pipelines.events.at(pipelineIndex);
         PipelineEvent event;
         while (queue.pop(event))
             event();
@@ -231,30 +239,106 @@ void ECS::Executor::buildPipelineGraph(const PipelineIndex pipelineIndex) noexce
         else
             return !beginPass();
     });
+    beginTask.setName(graph.name());
 
     // If pipeline does not contain any system, don't build further
     if (systems.empty()) [[unlikely]]
         return;
 
-    Flow::Task *prevTickTask = &beginTask;
-    Flow::Task *prevGraphTask = nullptr;
+    // Find the direct dependencies of each system: conflicting systems inserted before it, unless already reached through another dependency
+    const auto count = systems.size();
+    const auto wordCount = (count + 63u) / 64u;
+    Core::Vector<std::uint64_t, ECSAllocator> ancestors(count * wordCount, 0ull); // Systems that must be over before each system
+    Core::Vector<PipelineIndex, ECSAllocator> dependencies {};
+    Core::Vector<PipelineIndex, ECSAllocator> dependencyOffsets(count + 1, 0u);
+    Core::Vector<PipelineIndex, ECSAllocator> successorCounts(count, 0u);
+    for (PipelineIndex index = 0u; index != count; ++index) {
+        const auto systemAncestors = &ancestors[index * wordCount];
+        for (auto other = index; other-- != 0u;) {
+            if (systemAncestors[other / 64u] & (1ull << (other % 64u))
+                    || !systemAccesses[index].conflicts(systemNames[index], systemAccesses[other], systemNames[other]))
+                continue;
+            dependencies.push(other);
+            ++successorCounts[other];
+            const auto otherAncestors = &ancestors[other * wordCount];
+            for (PipelineIndex word = 0u; word != wordCount; ++word)
+                systemAncestors[word] |= otherAncestors[word];
+            systemAncestors[other / 64u] |= 1ull << (other % 64u);
+        }
+        dependencyOffsets[index + 1] = dependencies.size();
+    }
 
-    // For each system, record tick & graph tasks then link them to begin / end
-    for (auto &system : systems) {
-        auto &tickTask = graph.add([system = system.get()](void) -> bool { return !system->tick(); });
-        auto &graphTask = graph.add(&system->taskGraph());
+    // The begin task is a switch, it can only select a single task so root systems are joined behind an empty task if there are many
+    Flow::Task *startTask = &beginTask;
+    PipelineIndex rootCount {};
+    for (PipelineIndex index = 0u; index != count; ++index)
+        rootCount += dependencyOffsets[index] == dependencyOffsets[index + 1];
+    if (rootCount != 1u) {
+        startTask = &graph.add([] {}).setName(graph.name());
+        startTask->after(beginTask);
+    }
 
-        // Connect tick to previous tasks
-        tickTask.after(*prevTickTask);
-        if (prevGraphTask) [[likely]]
-            tickTask.after(*prevGraphTask);
-        // Connect tick to its graph
+    // For each system, record tick & graph tasks
+    Core::Vector<Flow::Task *, ECSAllocator> tickTasks(count, nullptr);
+    Core::Vector<Flow::Task *, ECSAllocator> endTasks(count, nullptr);
+    for (PipelineIndex index = 0u; auto &system : systems) {
+        const auto systemName = system->systemName().data();
+        auto &tickTask = graph.add([system = system.get()](void) -> bool { return !system->tick(); }).setName(systemName);
+        auto &graphTask = graph.add(&system->taskGraph()).setName(systemName);
+        system->taskGraph().setName(systemName);
         tickTask.before(graphTask);
+        tickTasks[index] = &tickTask;
+        endTasks[index] = &graphTask;
+        ++index;
+    }
+
+    // The tick task is a switch that selects either its graph task or its second linked task
+    // A system with many successors joins its tick & graph tasks behind an empty task, so it can skip its graph without skipping successors
+    for (PipelineIndex index = 0u; index != count; ++index) {
+        if (successorCounts[index] > 1u) {
+            auto &joinTask = graph.add([] {}).setName(systems[index]->systemName().data());
+            joinTask.after(*tickTasks[index]).after(*endTasks[index]);
+            endTasks[index] = &joinTask;
+        }
+    }
+
+    // Connect each system to its dependencies
+    for (PipelineIndex index = 0u; index != count; ++index) {
+        auto &tickTask = *tickTasks[index];
+        const auto begin = dependencyOffsets[index];
+        const auto end = dependencyOffsets[index + 1];
+        if (begin == end) {
+            tickTask.after(*startTask);
+            continue;
+        }
+        for (auto it = begin; it != end; ++it) {
+            const auto dependency = dependencies[it];
+            // A single successor is directly linked after its dependency tick task
+            if (successorCounts[dependency] == 1u)
+                tickTask.after(*tickTasks[dependency]);
+            tickTask.after(*endTasks[dependency]);
+        }
+    }
+}
 
-        // Set previous tasks
-        prevTickTask = &tickTask;
-        prevGraphTask = &graphTask;
+bool ECS::Executor::SystemAccess::conflicts(const Core::HashedName hash, const SystemAccess &other, const Core::HashedName otherHash) const noexcept
+{
+    const auto contains = [](const auto &hashes, const Core::HashedName value) {
+        return std::find(hashes.begin(), hashes.end(), value) != hashes.end();
+    };
+
+    // Systems without declared accesses and explicitly ordered systems always conflict
+    if (!declared || !other.declared || contains(dependencies, otherHash) || contains(other.dependencies, hash))
+        return true;
+    for (const auto write : writes) {
+        if (contains(other.writes, write) || contains(other.reads, write))
+            return true;
+    }
+    for (const auto write : other.writes) {
+        if (contains(reads, write))
+            return true;
     }
+    return false;
 }
 
 #if KUBE_PLATFORM_WINDOWS
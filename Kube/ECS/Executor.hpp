@@ -7,8 +7,10 @@
 
 #include <Kube/Core/Expected.hpp>
 #include <Kube/Core/MPSCQueue.hpp>
+#include <Kube/Core/SegmentedMPSCQueue.hpp>
 #include <Kube/Core/TrivialFunctor.hpp>
 #include <Kube/Core/UniquePtr.hpp>
+#include <Kube/Core/WaitQueue.hpp>
 #include <Kube/Flow/Scheduler.hpp>
 
 #include "System.hpp"
@@ -46,6 +48,25 @@ namespace kF::ECS
             using Type = SystemType;
             static constexpr bool After = true;
         };
+
+        /** @brief Explicit component accesses of a system */
+        template<bool IsWrite, typename ...Components>
+        struct TagAccess
+        {
+            static constexpr bool Write = IsWrite;
+
+            /** @brief Get the hashes of accessed components */
+            [[nodiscard]] static constexpr std::array<Core::HashedName, sizeof...(Components)> Hashes(void) noexcept
+                { return { ComponentHash<typename ForwardComponent<Components>::Type>()... }; }
+        };
+
+        /** @brief Check if a dependency is a component access tag */
+        template<typename Type>
+        constexpr bool IsAccessTag = false;
+
+        /** @brief Check if a dependency is a component access tag, success case */
+        template<bool IsWrite, typename ...Components>
+        constexpr bool IsAccessTag<TagAccess<IsWrite, Components...>> = true;
     }
 
     /** @brief Helper used to set explicit dependency before a system */
@@ -55,6 +76,16 @@ namespace kF::ECS
     /** @brief Helper used to set explicit dependency after a system */
     template<typename SystemType>
     constexpr auto RunAfter = Internal::TagAfter<SystemType>();
+
+    /** @brief Helper used to declare the components a system reads
+     *  A system declaring its accesses always writes its own components, it only runs concurrently with non conflicting systems */
+    template<typename ...Components>
+    constexpr auto Reads = Internal::TagAccess<false, Components...>();
+
+    /** @brief Helper used to declare the components a system writes
+     *  A system declaring its accesses always writes its own components, it only runs concurrently with non conflicting systems */
+    template<typename ...Components>
+    constexpr auto Writes = Internal::TagAccess<true, Components...>();
 }
 
 class alignas_double_cacheline kF::ECS::Executor
@@ -66,10 +97,19 @@ public:
     /** @brief Pipeline begin pass (if returns false, the whole pipeline is ignored) */
     using PipelineBeginPass = Core::TrivialFunctor<bool(void)>;
 
+    /** @brief Pipeline frame arena reset function */
+    using PipelineFrameReset = void(*)(void) noexcept;
+
 
     /** @brief Default number of events in pipeline event queue */
     constexpr static std::size_t DefaultPipelineEventQueueSize = 4096 / sizeof(PipelineEvent);
 
+    /** @brief Pipeline event queue size that selects an unbounded queue, senders never wait on bursts */
+    constexpr static std::size_t UnboundedPipelineEventQueueSize = ~static_cast<std::size_t>(0);
+
+    /** @brief Number of events per segment of unbounded pipeline event queues */
+    constexpr static std::size_t UnboundedPipelineEventSegmentSize = 4096 / sizeof(PipelineEvent);
+
     /** @brief Default number of events in executor event queue */
     constexpr static std::size_t DefaultExecutorEventQueueSize = 4096 / sizeof(ExecutorEvent);
 
@@ -98,8 +138,41 @@ public:
     /** @brief Store the systems of a pipeline */
     using PipelineSystems = SystemSmallVector<SystemPtr>;
 
-    /** @brief Store the events of a pipeline */
-    using PipelineEvents = Core::UniquePtr<Core::MPSCQueue<PipelineEvent, ECSAllocator>, ECSAllocator>;
+    /** @brief Components accessed by a system, two systems conflict if one writes a component the other accesses */
+    struct SystemAccess
+    {
+        bool declared {}; // A system that did not declare its accesses conflicts with any other system
+        Core::Vector<Core::HashedName, ECSAllocator> reads {};
+        Core::Vector<Core::HashedName, ECSAllocator> writes {};
+        Core::Vector<Core::HashedName, ECSAllocator> dependencies {}; // Systems explicitly ordered with this one
+
+        /** @brief Check if two systems must not run concurrently */
+        [[nodiscard]] bool conflicts(const Core::HashedName hash, const SystemAccess &other, const Core::HashedName otherHash) const noexcept;
+    };
+
+    /** @brief Store the component accesses of the systems of a pipeline */
+    using PipelineSystemAccesses = SystemSmallVector<SystemAccess>;
+
+    /** @brief Bounded event queue of a pipeline */
+    using PipelineBoundedEventQueue = Core::WaitQueue<Core::MPSCQueue<PipelineEvent, ECSAllocator>>;
+
+    /** @brief Unbounded event queue of a pipeline */
+    using PipelineUnboundedEventQueue = Core::SegmentedMPSCQueue<PipelineEvent, ECSAllocator, UnboundedPipelineEventSegmentSize>;
+
+    /** @brief Store the events of a pipeline, either in a bounded or an unbounded queue */
+    struct PipelineEvents
+    {
+        Core::UniquePtr<PipelineBoundedEventQueue, ECSAllocator> bounded {};
+        Core::UniquePtr<PipelineUnboundedEventQueue, ECSAllocator> unbounded {};
+
+        /** @brief Push an event, if RetryOnFailure is true the caller blocks while a bounded queue is full */
+        template<bool RetryOnFailure>
+        [[nodiscard]] inline bool push(PipelineEvent &event) noexcept;
+
+        /** @brief Pop an event */
+        [[nodiscard]] inline bool pop(PipelineEvent &event) noexcept
+            { return unbounded ? unbounded->pop(event) : bounded && bounded->pop(event); }
+    };
 
     /** @brief Store the graph of a pipeline */
     using PipelineGraph = Core::UniquePtr<Flow::Graph, ECSAllocator>;
@@ -131,10 +204,12 @@ public:
         PipelineSmallVector<PipelineEvents>         events {};
         PipelineSmallVector<PipelineSystemNames>    systemHashes {};
         PipelineSmallVector<PipelineSystems>        systems {};
+        PipelineSmallVector<PipelineSystemAccesses> systemAccesses {};
         PipelineSmallVector<PipelineClock>          clocks {};
         PipelineSmallVector<PipelineGraph>          graphs {};
         PipelineSmallVector<PipelineBeginPass>      inlineBeginPasses {};
         PipelineSmallVector<PipelineBeginPass>      beginPasses {};
+        PipelineSmallVector<PipelineFrameReset>     frameResets {};
         PipelineSmallVector<std::string_view>       names {};
     };
     static_assert_alignof_double_cacheline(Pipelines);
@@ -163,7 +238,8 @@ public:
     /** @brief Construct scheduler with a maximum amount of workers, tasks and events */
     Executor(const std::size_t workerCount = Flow::Scheduler::AutoWorkerCount,
             const std::size_t taskQueueSize = Flow::Scheduler::DefaultTaskQueueSize,
-            const std::size_t eventQueueSize = DefaultExecutorEventQueueSize) noexcept;
+            const std::size_t eventQueueSize = DefaultExecutorEventQueueSize,
+            const Flow::Scheduler::WorkerPlacement workerPlacement = Flow::Scheduler::WorkerPlacement::Unpinned) noexcept;
 
 
     /** @brief Get reference to graph scheduler */
@@ -181,25 +257,31 @@ public:
     void stop(void) noexcept;
 
 
-    /** @brief Add a pipeline into executor */
-    template<kF::ECS::Pipeline PipelineType, PipelineTimeMode TimeMode = PipelineTimeMode::Free,
+    /** @brief Add a pipeline into executor
+     *  @note Use 'UnboundedPipelineEventQueueSize' as 'eventQueueSize' to select an unbounded event queue
+     *  @note 'Priority' is used by the scheduler to run the pipeline graph (and its systems graphs) ahead of less urgent pipelines */
+    template<kF::ECS::Pipeline PipelineType, PipelineTimeMode TimeMode = PipelineTimeMode::Free, Flow::TaskPriority Priority = Flow::TaskPriority::Normal,
             typename BeginPass = PipelineBeginPass, typename InlineBeginPass = PipelineBeginPass>
     void addPipeline(const std::int64_t frequencyHz, const std::size_t eventQueueSize = DefaultPipelineEventQueueSize,
             BeginPass &&beginPass = PipelineBeginPass {}, InlineBeginPass &&inlineBeginPass = PipelineBeginPass {}) noexcept;
 
     /** @brief Alias to add pipeline without custom event queue size */
-    template<kF::ECS::Pipeline PipelineType, PipelineTimeMode TimeMode = PipelineTimeMode::Free,
+    template<kF::ECS::Pipeline PipelineType, PipelineTimeMode TimeMode = PipelineTimeMode::Free, Flow::TaskPriority Priority = Flow::TaskPriority::Normal,
             typename BeginPass = PipelineBeginPass, typename InlineBeginPass = PipelineBeginPass>
     void addPipeline(const std::int64_t frequencyHz, BeginPass &&beginPass, InlineBeginPass &&inlineBeginPass = PipelineBeginPass {}) noexcept
-        { addPipeline<PipelineType, TimeMode>(frequencyHz, DefaultPipelineEventQueueSize, std::forward<BeginPass>(beginPass), std::forward<InlineBeginPass>(inlineBeginPass)); }
+        { addPipeline<PipelineType, TimeMode, Priority>(frequencyHz, DefaultPipelineEventQueueSize, std::forward<BeginPass>(beginPass), std::forward<InlineBeginPass>(inlineBeginPass)); }
 
     /** @brief Alias to add pipeline without custom event queue size and only an inline begin pass */
-    template<kF::ECS::Pipeline PipelineType, PipelineTimeMode TimeMode = PipelineTimeMode::Free, typename InlineBeginPass>
+    template<kF::ECS::Pipeline PipelineType, PipelineTimeMode TimeMode = PipelineTimeMode::Free, Flow::TaskPriority Priority = Flow::TaskPriority::Normal,
+            typename InlineBeginPass>
     void addPipelineInline(const std::int64_t frequencyHz, InlineBeginPass &&inlineBeginPass) noexcept
-        { addPipeline<PipelineType, TimeMode>(frequencyHz, DefaultPipelineEventQueueSize, PipelineBeginPass {}, std::forward<InlineBeginPass>(inlineBeginPass)); }
+        { addPipeline<PipelineType, TimeMode, Priority>(frequencyHz, DefaultPipelineEventQueueSize, PipelineBeginPass {}, std::forward<InlineBeginPass>(inlineBeginPass)); }
 
 
-    /** @brief Add a system into executor (system's pipeline must be setup before) */
+    /** @brief Add a system into executor (system's pipeline must be setup before)
+     *  'Dependencies' can either be explicit dependencies (RunBefore / RunAfter) or component accesses (Reads / Writes)
+     *  Systems that declared their component accesses run concurrently with the systems they don't conflict with,
+     *  other systems run in insertion order */
     template<typename SystemType, auto ...Dependencies, typename ...Args>
         requires std::derived_from<SystemType, kF::ECS::Internal::ASystem>
     SystemType &addSystem(Args &&...args) noexcept;
@@ -219,6 +301,10 @@ public:
     /** @brief Get pipeline tick rate from pipeline index */
     void setPipelineTickRate(const PipelineIndex pipelineIndex, const std::int64_t frequencyHz) noexcept;
 
+    /** @brief Get pipeline scheduling priority from pipeline index */
+    [[nodiscard]] inline Flow::TaskPriority getPipelinePriority(const PipelineIndex pipelineIndex) const noexcept
+        { return _pipelines.graphs.at(pipelineIndex)->priority(); }
+
     /** @brief Get pipeline time bound state from pipeline index */
     [[nodiscard]] inline bool isPipelineTimeBound(const PipelineIndex pipelineIndex) const noexcept
         { return _pipelines.clocks.at(pipelineIndex).isTimeBound(); }
@@ -240,7 +326,8 @@ public:
         { return _pipelines.systems.at(pipelineIndex).at(systemIndex).get(); }
 
 
-    /** @brief Send an event to a system */
+    /** @brief Send an event to a system
+     *  @note If RetryOnFailure is true, the caller blocks while the pipeline event queue is full */
     template<typename DestinationPipeline, bool RetryOnFailure = true, typename Callback>
     void sendEvent(Callback &&callback) noexcept;
 
@@ -253,16 +340,16 @@ private:
     // Global access instance
     static Executor *_Instance;
 
-    // Cacheline 0 -> 13
+    // Cacheline 0 -> 27
     Flow::Scheduler _scheduler {};
 
-    // Cacheline 14 -> 17
+    // Cacheline 28 -> 31
     Core::MPSCQueue<ExecutorEvent, ECSAllocator> _eventQueue;
 
-    // Cacheline 18 -> 19
+    // Cacheline 32 -> 33
     Cache _cache {};
 
-    // Cacheline 20 -> ... (depend on 'OptimalPipelineCount')
+    // Cacheline 34 -> ... (depend on 'OptimalPipelineCount')
     Pipelines _pipelines {};
 
     /** @brief Process executor events */
@@ -278,7 +365,8 @@ private:
     /** @brief Build all pipeline graphs */
     void buildPipelineGraphs(void) noexcept;
 
-    /** @brief Build a pipeline graph given its index */
+    /** @brief Build a pipeline graph given its index
+     *  A system runs after each conflicting system inserted before it, the graph only keeps the direct dependencies */
     void buildPipelineGraph(const PipelineIndex pipelineIndex) noexcept;
 
     /** @brief Wait executor to enter IDLE state (no pipeline running) */
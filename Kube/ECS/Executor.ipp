@@ -3,13 +3,11 @@
  * @ Description: System executor
  */
 
-#include <thread>
-
 #include <Kube/Core/FunctionDecomposer.hpp>
 
 #include "Executor.hpp"
 
-template<kF::ECS::Pipeline PipelineType, kF::ECS::PipelineTimeMode TimeMode, typename BeginPass, typename InlineBeginPass>
+template<kF::ECS::Pipeline PipelineType, kF::ECS::PipelineTimeMode TimeMode, kF::Flow::TaskPriority Priority, typename BeginPass, typename InlineBeginPass>
 inline void kF::ECS::Executor::addPipeline(const std::int64_t frequencyHz, const std::size_t eventQueueSize,
         BeginPass &&beginPass, InlineBeginPass &&inlineBeginPass) noexcept
 {
@@ -18,7 +16,12 @@ inline void kF::ECS::Executor::addPipeline(const std::int64_t frequencyHz, const
     _pipelines.hashes.push(PipelineType::Hash);
     _pipelines.systemHashes.push();
     _pipelines.systems.push();
-    _pipelines.events.push(eventQueueSize ? PipelineEvents::Make(eventQueueSize) : PipelineEvents());
+    _pipelines.systemAccesses.push();
+    auto &events = _pipelines.events.push();
+    if (eventQueueSize == UnboundedPipelineEventQueueSize)
+        events.unbounded = Core::UniquePtr<PipelineUnboundedEventQueue, ECSAllocator>::Make();
+    else if (eventQueueSize)
+        events.bounded = Core::UniquePtr<PipelineBoundedEventQueue, ECSAllocator>::Make(eventQueueSize);
     _pipelines.clocks.push(PipelineClock {
         .maskedTickRate = [tickRate = HzToRate(frequencyHz)] {
             if constexpr (TimeMode == PipelineTimeMode::Bound)
@@ -27,9 +30,10 @@ inline void kF::ECS::Executor::addPipeline(const std::int64_t frequencyHz, const
                 return tickRate;
         }(),
     });
-    _pipelines.graphs.push(PipelineGraph::Make());
+    _pipelines.graphs.push(PipelineGraph::Make())->setPriority(Priority);
     _pipelines.inlineBeginPasses.push(std::forward<InlineBeginPass>(inlineBeginPass));
     _pipelines.beginPasses.push(std::forward<BeginPass>(beginPass));
+    _pipelines.frameResets.push(&PipelineType::FrameArena::Reset);
     _pipelines.names.push(PipelineType::Name);
 }
 
@@ -48,32 +52,57 @@ inline SystemType &kF::ECS::Executor::addSystem(Args &&...args) noexcept
     // Determine system insert position
     auto &systems = _pipelines.systems.at(*expected);
     auto &systemNames = _pipelines.systemHashes.at(*expected);
+    auto &systemAccesses = _pipelines.systemAccesses.at(*expected);
     auto insertAt = systemNames.end();
-    // Scan dependencies
-    if constexpr (sizeof...(Dependencies) != 0) {
+    SystemAccess access {};
+    // Record component accesses, a system declaring them always writes its own components
+    if constexpr ((Internal::IsAccessTag<std::remove_cvref_t<decltype(Dependencies)>> || ...)) {
+        access.declared = true;
+        if constexpr (requires { typename SystemType::ComponentsTuple; }) {
+            [&access]<typename ...Components>(std::type_identity<std::tuple<Components...>>) {
+                (access.writes.push(Internal::ComponentHash<Components>()), ...);
+            }(std::type_identity<typename SystemType::ComponentsTuple>());
+        }
+        auto recordFunc = [&access]<typename DependencyHolder>(DependencyHolder) {
+            if constexpr (Internal::IsAccessTag<DependencyHolder>) {
+                auto &hashes = DependencyHolder::Write ? access.writes : access.reads;
+                for (const auto hash : DependencyHolder::Hashes())
+                    hashes.push(hash);
+            } else
+                access.dependencies.push(DependencyHolder::Type::Hash);
+        };
+        (recordFunc(Dependencies), ...);
+    }
+    // Scan explicit dependencies
+    if constexpr ((!Internal::IsAccessTag<std::remove_cvref_t<decltype(Dependencies)>> || ...)) {
         kFEnsure(insertAt != nullptr,
             "ECS::Executor::addSystem: System '", SystemType::Name, "' is added before its dependencies");
         auto orderFunc = [&systemNames]<typename DependencyHolder>(auto &insertAt, DependencyHolder) {
-            // Deduce dependency type
-            using Dependency = DependencyHolder::Type;
-
-            // Find dependency at runtime
-            const auto dependencyIt = systemNames.find(Dependency::Hash);
-            kFEnsure(dependencyIt != systemNames.end(),
-                "ECS::Executor::addSystem: Dependency '", Dependency::Name, "' of system '", SystemType::Name, "' not found");
-            // Ensure iterator met dependency requirement
-            if constexpr (DependencyHolder::After) {
-                if (insertAt <= dependencyIt) {
-                    insertAt = dependencyIt + 1;
-                    return true;
-                }
-            } else {
-                if (insertAt > dependencyIt) {
-                    insertAt = dependencyIt;
-                    return true;
+            // Component accesses don't constrain the insert position
+            if constexpr (Internal::IsAccessTag<DependencyHolder>)
+                return false;
+            else {
+                // Deduce dependency type
+                using Dependency = DependencyHolder::Type;
+
+                // Find dependency at runtime
+                const auto dependencyIt = systemNames.find(Dependency::Hash);
+                kFEnsure(dependencyIt != systemNames.end(),
+                    "ECS::Executor::addSystem: Dependency '", Dependency::Name, "' of system '", SystemType::Name, "' not found");
+                // Ensure iterator met dependency requirement
+                if constexpr (DependencyHolder::After) {
+                    if (insertAt <= dependencyIt) {
+                        insertAt = dependencyIt + 1;
+                        return true;
+                    }
+                } else {
+                    if (insertAt > dependencyIt) {
+                        insertAt = dependencyIt;
+                        return true;
+                    }
                 }
+                return false;
             }
-            return false;
         };
         // For each dependency, run order functor
         if ((orderFunc(insertAt, Dependencies) || ...)) {
@@ -89,6 +118,10 @@ inline SystemType &kF::ECS::Executor::addSystem(Args &&...args) noexcept
         insertAt,
         SystemType::Hash
     );
+    systemAccesses.insert(
+        systemAccesses.begin() + insertIndex,
+        std::move(access)
+    );
     const auto systemIt = systems.insert(
         systems.begin() + insertIndex,
         SystemPtr::Make<SystemType>(std::forward<Args>(args)...)
@@ -153,17 +186,20 @@ inline void kF::ECS::Executor::sendEvent(const std::uint32_t pipelineIndex, Call
     } else
         pipelineEvent = std::forward<Callback>(callback);
 
-    // When RetryOnFailure is set to true, loop until event is pushed
-    bool res = false;
-    while (true) {
-        res = _pipelines.events.at(pipelineIndex)->push<true>(pipelineEvent);
-        if constexpr (RetryOnFailure) {
-            if (!res) {
-                std::this_thread::yield();
-                continue;
-            }
-        }
-        break;
-    }
+    const auto res = _pipelines.events.at(pipelineIndex).push<RetryOnFailure>(pipelineEvent);
     kFEnsure(res, "Executor::sendEvent: Critical error, event queue is full");
-}
\ No newline at end of file
+}
+
+template<bool RetryOnFailure>
+inline bool kF::ECS::Executor::PipelineEvents::push(PipelineEvent &event) noexcept
+{
+    if (unbounded)
+        return unbounded->push<true>(event);
+    else if (!bounded) [[unlikely]]
+        return false;
+    // When RetryOnFailure is set to true, wait until event is pushed
+    else if constexpr (RetryOnFailure)
+        return bounded->pushWait<true>(event);
+    else
+        return bounded->push<true>(event);
+}
@@ -0,0 +1,102 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Group
+ */
+
+#pragma once
+
+#include <tuple>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    template<typename OwnedTables>
+    class Group;
+}
+
+/** @brief Owning group over tables that store the entities having every owned component packed in the same order
+ *  @note The 'size' first components of each table belong to the group, iterating them is a linear scan
+ *  @note Tables must not be structurally modified (add / remove) while the group is traversed */
+template<typename ...Tables>
+class kF::ECS::Group<std::tuple<Tables...>>
+{
+public:
+    static_assert(sizeof...(Tables) != 0, "ECS::Group: A group requires at least one component");
+
+    /** @brief Value yielded by the group iterator */
+    using Value = std::tuple<Entity, decltype(std::declval<Tables &>().atIndex(EntityIndex {})) ...>;
+
+
+    /** @brief Iterator over grouped entities */
+    class Iterator
+    {
+    public:
+        /** @brief Value constructor */
+        inline Iterator(const Group * const group, const EntityIndex index) noexcept : _group(group), _index(index) {}
+
+        /** @brief Copy constructor */
+        inline Iterator(const Iterator &other) noexcept = default;
+
+        /** @brief Copy assignment */
+        inline Iterator &operator=(const Iterator &other) noexcept = default;
+
+
+        /** @brief Dereference iterator */
+        [[nodiscard]] inline Value operator*(void) const noexcept { return _group->at(_index); }
+
+
+        /** @brief Prefix increment operator */
+        inline Iterator &operator++(void) noexcept { ++_index; return *this; }
+
+        /** @brief Postfix increment operator */
+        [[nodiscard]] inline Iterator operator++(int) noexcept { const auto past = *this; ++*this; return past; }
+
+
+        /** @brief Equal operators */
+        [[nodiscard]] inline bool operator==(const Iterator &other) const noexcept { return _index == other._index; }
+        [[nodiscard]] inline bool operator!=(const Iterator &other) const noexcept { return _index != other._index; }
+
+    private:
+        const Group *_group {};
+        EntityIndex _index {};
+    };
+
+
+    /** @brief Construct the group from its size and owned tables */
+    inline Group(const EntityIndex &size, Tables &...tables) noexcept : _size(&size), _tables(&tables...) {}
+
+    /** @brief Copy constructor */
+    Group(const Group &other) noexcept = default;
+
+    /** @brief Copy assignment */
+    Group &operator=(const Group &other) noexcept = default;
+
+
+    /** @brief Get the number of entities in the group */
+    [[nodiscard]] inline EntityIndex size(void) const noexcept { return *_size; }
+
+    /** @brief Check if the group is empty */
+    [[nodiscard]] inline bool empty(void) const noexcept { return !*_size; }
+
+
+    /** @brief Get the entity and components at a given group index */
+    [[nodiscard]] Value at(const EntityIndex index) const noexcept;
+
+
+    /** @brief Begin / end iterators, yielding (Entity, Components &...) tuples */
+    [[nodiscard]] inline Iterator begin(void) const noexcept { return Iterator(this, 0); }
+    [[nodiscard]] inline Iterator end(void) const noexcept { return Iterator(this, *_size); }
+
+
+    /** @brief Traverse the group with a callback taking (Entity, Components &...) as arguments or only (Components &...)
+     *  @note If the callback returns a boolean, traversal is stopped when 'false' is returned */
+    template<typename Callback>
+    void each(Callback &&callback) const noexcept;
+
+private:
+    const EntityIndex *_size {};
+    std::tuple<Tables *...> _tables {};
+};
+
+#include "Group.ipp"
@@ -0,0 +1,40 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Group
+ */
+
+#include "Group.hpp"
+
+template<typename ...Tables>
+inline typename kF::ECS::Group<std::tuple<Tables...>>::Value kF::ECS::Group<std::tuple<Tables...>>::at(const EntityIndex index) const noexcept
+{
+    return std::apply([index](Tables * const ...tables) {
+        return Value(std::get<0>(std::tie(tables...))->entities().at(index), tables->atIndex(index)...);
+    }, _tables);
+}
+
+template<typename ...Tables>
+template<typename Callback>
+inline void kF::ECS::Group<std::tuple<Tables...>>::each(Callback &&callback) const noexcept
+{
+    std::apply([size = *_size, &callback](Tables * const ...tables) {
+        const auto &entities = std::get<0>(std::tie(tables...))->entities();
+        for (EntityIndex index {}; index != size; ++index) {
+            // Entity & Components
+            if constexpr (std::is_invocable_v<Callback, Entity, decltype(tables->atIndex(index))...>) {
+                if constexpr (std::is_same_v<std::invoke_result_t<Callback, Entity, decltype(tables->atIndex(index))...>, bool>) {
+                    if (!callback(entities.at(index), tables->atIndex(index)...))
+                        break;
+                } else
+                    callback(entities.at(index), tables->atIndex(index)...);
+            // Components only
+            } else {
+                if constexpr (std::is_same_v<std::invoke_result_t<Callback, decltype(tables->atIndex(index))...>, bool>) {
+                    if (!callback(tables->atIndex(index)...))
+                        break;
+                } else
+                    callback(tables->atIndex(index)...);
+            }
+        }
+    }, _tables);
+}
@@ -7,6 +7,7 @@
 
 #include <Kube/Core/Hash.hpp>
 #include <Kube/Core/FixedString.hpp>
+#include <Kube/Core/FrameArena.hpp>
 
 namespace kF::ECS
 {
@@ -27,6 +28,11 @@ namespace kF::ECS
 
         /** @brief Pipeline hashed name */
         static constexpr auto Hash = Core::Hash(Name);
+
+        /** @brief Pipeline frame arena, reset by the executor at the beginning of each pipeline tick
+         *  @note Memory allocated from this arena must not outlive the pipeline tick it was allocated in
+         *  @note The arena is reset after the inline begin pass, which must not allocate from it */
+        using FrameArena = Core::FrameArena<Literal>;
     };
 
     /** @brief Pipeline concept */
@@ -11,6 +11,8 @@
 #include "Pipeline.hpp"
 #include "ComponentTable.hpp"
 #include "StableComponentTable.hpp"
+#include "View.hpp"
+#include "Group.hpp"
 
 namespace kF::ECS
 {
@@ -106,9 +108,19 @@ public:
     /** @brief Static component table list */
     using ComponentTablesTuple = std::tuple<typename Internal::ForwardComponentTable<ComponentTypes, EntityPageSize, Allocator>::Type...>;
 
+    /** @brief Get the table type of a component */
+    template<typename Component>
+    using ComponentTableType = std::tuple_element_t<Core::TupleElementIndex<std::remove_cvref_t<Component>, ComponentsTuple>, ComponentTablesTuple>;
+
     /** @brief Number of component tables in this system */
     static constexpr std::size_t ComponentCount = sizeof...(ComponentTypes);
 
+    /** @brief Maximum number of owning groups, a component is owned by at most one group of at least two components */
+    static constexpr std::size_t MaxGroupCount = ComponentCount / 2;
+
+    /** @brief Mask of owned component indexes */
+    using ComponentMask = std::uint64_t;
+
 
     /** @brief Virtual destructor */
     virtual ~System(void) noexcept override = default;
@@ -251,18 +263,81 @@ public:
         { return getTable<Component>().get(entity); }
 
 
+    /** @brief Get a view over the entities that have every 'Components'
+     *  @note Entities having any component declared with 'Exclude<...>' are skipped */
+    template<typename ...Components, typename ...Excluded>
+        requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components..., Excluded...>
+    [[nodiscard]] inline auto view(const Internal::TagExclude<Excluded...> = {}) noexcept
+        { return View<std::tuple<ComponentTableType<Components>...>, std::tuple<ComponentTableType<Excluded>...>>(getTable<Components>()..., getTable<Excluded>()...); }
+    template<typename ...Components, typename ...Excluded>
+        requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components..., Excluded...>
+    [[nodiscard]] inline auto view(const Internal::TagExclude<Excluded...> = {}) const noexcept
+        { return View<std::tuple<const ComponentTableType<Components>...>, std::tuple<ComponentTableType<Excluded>...>>(getTable<Components>()..., getTable<Excluded>()...); }
+
+
+    /** @brief Get the owning group of 'Components', the group is created on first call
+     *  @note Entities having every owned component are packed at the front of each owned table, in the same order
+     *  @note Owned tables must only be modified through the system and must not be sorted */
+    template<typename ...Components>
+        requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
+    [[nodiscard]] Group<std::tuple<ComponentTableType<Components>...>> group(void) noexcept;
+
+
     /** @brief Calls a functor for each component table */
     template<typename Functor>
     inline void forEachTable(Functor &&delegate) noexcept
         { (delegate(get<ComponentTypes>()), ...); }
 
 private:
+    /** @brief Owning group state */
+    struct OwningGroup
+    {
+        ComponentMask mask {};
+        EntityIndex size {};
+    };
+
+    /** @brief Index of a component inside the system */
+    template<typename Component>
+    static constexpr std::size_t ComponentIndex = Core::TupleElementIndex<std::remove_cvref_t<Component>, ComponentsTuple>;
+
+
     using Internal::ASystem::queryPipelineIndex;
     using Internal::ASystem::remove;
     using Internal::ASystem::removeRange;
 
+
+    /** @brief Insert an entity into the groups owning 'Components' */
+    template<typename ...Components>
+    void enterGroups(const Entity entity) noexcept;
+    template<typename ...Components>
+    void enterGroups(const EntityRange range) noexcept;
+
+    /** @brief Remove an entity from the groups owning 'Components' */
+    template<typename ...Components>
+    void leaveGroups(const Entity entity) noexcept;
+    template<typename ...Components>
+    void leaveGroups(const EntityRange range) noexcept;
+
+    /** @brief Remove an entity from every group */
+    void leaveAllGroups(const Entity entity) noexcept;
+    void leaveAllGroups(const EntityRange range) noexcept;
+
+    /** @brief Insert an entity into a group if it has every owned component */
+    void enterGroup(OwningGroup &group, const Entity entity) noexcept;
+
+    /** @brief Remove an entity from a group if it belongs to it */
+    void leaveGroup(OwningGroup &group, const Entity entity) noexcept;
+
+    /** @brief Calls a functor for each table owned by a group */
+    template<typename Functor>
+    void forEachGroupTable(const ComponentMask mask, Functor &&functor) noexcept;
+
+
     // Cacheline 1 -> ?
     [[no_unique_address]] ComponentTablesTuple _tables {};
+    std::array<std::uint8_t, ComponentCount> _componentGroups {}; // Group index + 1 owning each component, 0 if not owned
+    std::array<OwningGroup, MaxGroupCount> _groups {};
+    std::uint8_t _groupCount {};
 };
 
 #include "System.ipp"
@@ -59,6 +59,7 @@ template<typename ...Components>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::attach(const Entity entity, Components &&...components) noexcept
 {
     ((getTable<Components>().add(entity, std::forward<Components>(components))), ...);
+    enterGroups<Components...>(entity);
 }
 
 template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
@@ -67,6 +68,7 @@ template<typename ...Components>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::tryAttach(const Entity entity, Components &&...components) noexcept
 {
     ((getTable<Components>().tryAdd(entity, std::forward<Components>(components))), ...);
+    enterGroups<Components...>(entity);
 }
 
 template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
@@ -77,6 +79,7 @@ inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes..
         using Decomposer = Core::FunctionDecomposerHelper<Functor>;
         using Component = std::remove_cvref_t<std::tuple_element_t<0, typename Decomposer::ArgsTuple>>;
         getTable<Component>().tryAdd(entity, std::forward<Functor>(functor));
+        enterGroups<Component>(entity);
     };
 
     ((apply(std::forward<Functors>(functors))), ...);
@@ -88,6 +91,7 @@ template<typename ...Components>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::attachRange(const EntityRange range, Components &&...components) noexcept
 {
     ((getTable<Components>().addRange(range, std::forward<Components>(components))), ...);
+    enterGroups<Components...>(range);
 }
 
 template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
@@ -95,6 +99,7 @@ template<typename ...Components>
     requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::dettach(const Entity entity) noexcept
 {
+    leaveGroups<Components...>(entity);
     ((getTable<Components>().remove(entity)), ...);
 }
 
@@ -103,6 +108,7 @@ template<typename ...Components>
     requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::tryDettach(const Entity entity) noexcept
 {
+    leaveGroups<Components...>(entity);
     ((getTable<Components>().tryRemove(entity)), ...);
 }
 
@@ -111,6 +117,7 @@ template<typename ...Components>
     requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::dettachRange(const EntityRange range) noexcept
 {
+    leaveGroups<Components...>(range);
     ((getTable<Components>().removeRange(range)), ...);
 }
 
@@ -121,6 +128,7 @@ inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes..
         ((std::get<Indexes>(_tables).tryRemove(entity)), ...);
     };
 
+    leaveAllGroups(entity);
     wrapper(entity, std::make_integer_sequence<Entity, ComponentCount> {});
     Internal::ASystem::remove(entity);
 }
@@ -132,6 +140,7 @@ inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes..
         ((std::get<Indexes>(_tables).removeRange(range)), ...);
     };
 
+    leaveAllGroups(range);
     wrapper(range, std::make_integer_sequence<Entity, ComponentCount> {});
     Internal::ASystem::removeRange(range);
 }
@@ -141,6 +150,7 @@ template<typename ...Components>
     requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::removeUnsafe(const Entity entity) noexcept
 {
+    leaveGroups<Components...>(entity);
     ((getTable<Components>().remove(entity)), ...);
     Internal::ASystem::remove(entity);
 }
@@ -150,10 +160,166 @@ template<typename ...Components>
     requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::removeUnsafeRange(const EntityRange range) noexcept
 {
+    leaveGroups<Components...>(range);
     ((getTable<Components>().removeRange(range)), ...);
     Internal::ASystem::removeRange(range);
 }
 
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename ...Components>
+    requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
+inline kF::ECS::Group<std::tuple<typename kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::template ComponentTableType<Components>...>>
+    kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::group(void) noexcept
+{
+    static_assert(sizeof...(Components) >= 2, "ECS::System::group: An owning group requires at least two components");
+    static_assert(ComponentCount <= sizeof(ComponentMask) * 8, "ECS::System::group: Too many components to use owning groups");
+    static_assert(!(ComponentTableType<Components>::IsStable || ...), "ECS::System::group: Stable components cannot be owned by a group");
+
+    constexpr ComponentMask Mask = ((ComponentMask(1) << ComponentIndex<Components>) | ...);
+    constexpr auto FirstIndex = ComponentIndex<std::tuple_element_t<0, std::tuple<Components...>>>;
+
+    auto groupId = _componentGroups[FirstIndex];
+    if (groupId) [[likely]] {
+        kFEnsure(_groups[groupId - 1u].mask == Mask,
+            "ECS::System::group: Group components of system '", Name, "' mismatch the existing group owning them");
+    } else {
+        kFEnsure(((_componentGroups[ComponentIndex<Components>] == 0) && ...),
+            "ECS::System::group: A component of system '", Name, "' is already owned by another group");
+        groupId = ++_groupCount;
+        auto &group = _groups[groupId - 1u];
+        group.mask = Mask;
+        ((_componentGroups[ComponentIndex<Components>] = groupId), ...);
+        // Pack entities that already have every owned component
+        const auto &entities = std::get<FirstIndex>(_tables).entities();
+        for (EntityIndex index {}, count = entities.size(); index != count; ++index)
+            enterGroup(group, entities.at(index));
+    }
+    return Group<std::tuple<ComponentTableType<Components>...>>(_groups[groupId - 1u].size, getTable<Components>()...);
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename ...Components>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::enterGroups(const Entity entity) noexcept
+{
+    const auto enter = [this, entity](const auto groupId) {
+        if (groupId) [[unlikely]]
+            enterGroup(_groups[groupId - 1u], entity);
+    };
+
+    (enter(_componentGroups[ComponentIndex<Components>]), ...);
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename ...Components>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::enterGroups(const EntityRange range) noexcept
+{
+    const auto enter = [this, range](const auto groupId) {
+        if (groupId) [[unlikely]] {
+            for (auto entity = range.begin; entity != range.end; ++entity)
+                enterGroup(_groups[groupId - 1u], entity);
+        }
+    };
+
+    (enter(_componentGroups[ComponentIndex<Components>]), ...);
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename ...Components>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::leaveGroups(const Entity entity) noexcept
+{
+    const auto leave = [this, entity](const auto groupId) {
+        if (groupId) [[unlikely]]
+            leaveGroup(_groups[groupId - 1u], entity);
+    };
+
+    (leave(_componentGroups[ComponentIndex<Components>]), ...);
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename ...Components>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::leaveGroups(const EntityRange range) noexcept
+{
+    const auto leave = [this, range](const auto groupId) {
+        if (groupId) [[unlikely]] {
+            for (auto entity = range.begin; entity != range.end; ++entity)
+                leaveGroup(_groups[groupId - 1u], entity);
+        }
+    };
+
+    (leave(_componentGroups[ComponentIndex<Components>]), ...);
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::leaveAllGroups(const Entity entity) noexcept
+{
+    for (std::uint8_t groupIndex {}; groupIndex != _groupCount; ++groupIndex)
+        leaveGroup(_groups[groupIndex], entity);
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::leaveAllGroups(const EntityRange range) noexcept
+{
+    for (std::uint8_t groupIndex {}; groupIndex != _groupCount; ++groupIndex) {
+        for (auto entity = range.begin; entity != range.end; ++entity)
+            leaveGroup(_groups[groupIndex], entity);
+    }
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::enterGroup(OwningGroup &group, const Entity entity) noexcept
+{
+    // Ensure entity has every owned component and is not already inside the group
+    bool complete = true;
+    bool grouped = false;
+    forEachGroupTable(group.mask, [entity, &group, &complete, &grouped](const auto &table) {
+        const auto index = table.getUnstableIndex(entity);
+        complete &= index != NullEntityIndex;
+        grouped |= index < group.size;
+    });
+    if (!complete || grouped)
+        return;
+
+    // Move entity at the end of the group in each owned table
+    forEachGroupTable(group.mask, [entity, &group](auto &table) {
+        table.swapIndexes(table.getUnstableIndex(entity), group.size);
+    });
+    ++group.size;
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::leaveGroup(OwningGroup &group, const Entity entity) noexcept
+{
+    // Ensure entity is inside the group
+    bool grouped = true;
+    forEachGroupTable(group.mask, [entity, &group, &grouped](const auto &table) {
+        grouped &= table.getUnstableIndex(entity) < group.size;
+    });
+    if (!grouped)
+        return;
+
+    // Move entity right after the end of the group in each owned table
+    --group.size;
+    forEachGroupTable(group.mask, [entity, &group](auto &table) {
+        table.swapIndexes(table.getUnstableIndex(entity), group.size);
+    });
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename Functor>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::forEachGroupTable(const ComponentMask mask, Functor &&functor) noexcept
+{
+    [this, mask, &functor]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+        [[maybe_unused]] const auto apply = [mask, &functor]<typename Table>(const std::size_t index, Table &table) {
+            // Stable tables can't be owned by a group
+            if constexpr (!Table::IsStable) {
+                if (mask & (ComponentMask(1) << index))
+                    functor(table);
+            }
+        };
+        (apply(Indexes, std::get<Indexes>(_tables)), ...);
+    }(std::make_index_sequence<ComponentCount>());
+}
+
 template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
 template<bool RetryOnFailure, typename Callback>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::interact(Callback &&callback) const noexcept
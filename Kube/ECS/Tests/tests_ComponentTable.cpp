@@ -456,6 +456,73 @@ using StableComponentTableType = ECS::StableComponentTable<TestComponent, 4096 /
 TEST_COMPONENT_TABLE(ComponentTable, ComponentTableType)
 TEST_COMPONENT_TABLE(StableComponentTable, StableComponentTableType)
 
+template<ECS::SortOrder Order, typename Key>
+void TestTableSortByKey(const ECS::EntityIndex count, const ECS::EntityIndex shuffleCount) noexcept
+{
+    struct Component
+    {
+        Key key {};
+        ECS::Entity entity {};
+    };
+    ECS::ComponentTable<Component, 4096 / sizeof(ECS::Entity)> table;
+
+    // Add sorted keys with duplicates, then shuffle some of them
+    for (ECS::Entity entity = 1; entity <= count; ++entity) {
+        const auto rank = Order == ECS::SortOrder::Ascending ? entity : count - entity;
+        table.add(entity, Component { .key = static_cast<Key>(static_cast<Key>(rank / 3) - static_cast<Key>(count / 6)), .entity = entity });
+    }
+    for (auto i = 0u; i != shuffleCount; ++i)
+        std::swap(table.atIndex(Core::Random::Generate32(count)).key, table.atIndex(Core::Random::Generate32(count)).key);
+
+    table.template sortByKey<Order>([](const Component &component) { return component.key; });
+
+    // Test order, stability & sparse set
+    for (ECS::EntityIndex index {}; index != count; ++index) {
+        const auto &component = table.atIndex(index);
+        ASSERT_EQ(table.entities().at(index), component.entity);
+        ASSERT_EQ(&table.get(component.entity), &component);
+        if (!index)
+            continue;
+        const auto &previous = table.atIndex(index - 1);
+        if (previous.key == component.key) {
+            ASSERT_LT(previous.entity, component.entity);
+        } else if constexpr (Order == ECS::SortOrder::Ascending) {
+            ASSERT_LT(previous.key, component.key);
+        } else {
+            ASSERT_GT(previous.key, component.key);
+        }
+    }
+}
+
+TEST(ComponentTable, SortByKey)
+{
+    // Already sorted
+    TestTableSortByKey<ECS::SortOrder::Ascending, std::uint32_t>(1000, 0);
+    // Nearly sorted, insertion sort
+    TestTableSortByKey<ECS::SortOrder::Ascending, std::uint32_t>(1000, 10);
+    TestTableSortByKey<ECS::SortOrder::Descending, std::int32_t>(1000, 10);
+    // Shuffled, radix sort
+    TestTableSortByKey<ECS::SortOrder::Ascending, std::uint32_t>(1000, 1000);
+    TestTableSortByKey<ECS::SortOrder::Ascending, std::int16_t>(1000, 1000);
+    TestTableSortByKey<ECS::SortOrder::Descending, std::int64_t>(1000, 1000);
+    TestTableSortByKey<ECS::SortOrder::Descending, std::uint8_t>(1000, 1000);
+}
+
+TEST(ComponentTable, SortByKeyEntity)
+{
+    ECS::ComponentTable<TestComponent, 4096 / sizeof(ECS::Entity)> table;
+    for (ECS::Entity entity = 1; entity <= 100; ++entity)
+        table.add(entity, std::make_unique<int>(static_cast<int>(entity)));
+
+    // Reverse order using entity key
+    table.sortByKey<ECS::SortOrder::Descending>([](const ECS::Entity entity) { return entity; });
+    for (ECS::EntityIndex index {}; index != 100; ++index) {
+        ASSERT_EQ(table.entities().at(index), 100 - index);
+        ASSERT_EQ(*table.atIndex(index), static_cast<int>(100 - index));
+        ASSERT_EQ(*table.get(100 - index), static_cast<int>(100 - index));
+    }
+}
+
 TEST(StableComponentTable, PackSparseHoles)
 {
     static constexpr ECS::EntityRange TestEntityRange { 0u, 100u };
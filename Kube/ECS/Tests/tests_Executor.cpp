@@ -300,4 +300,108 @@ GENERATE_EXECUTOR_INDIVIDUAL_SAMPLE_TIMING_RANGE(NegligableWork)
 GENERATE_EXECUTOR_INDIVIDUAL_SAMPLE_TIMING_RANGE(LightWork)
 GENERATE_EXECUTOR_INDIVIDUAL_SAMPLE_TIMING_RANGE(MediumWork)
 GENERATE_EXECUTOR_INDIVIDUAL_SAMPLE_TIMING_RANGE(HeavyWork)
-GENERATE_EXECUTOR_INDIVIDUAL_SAMPLE_TIMING_RANGE(HardcoreWork)
\ No newline at end of file
+GENERATE_EXECUTOR_INDIVIDUAL_SAMPLE_TIMING_RANGE(HardcoreWork)
+
+// Concurrency state shared by systems of a pipeline
+struct ConcurrencyState
+{
+    std::atomic_size_t running {};
+    std::atomic_size_t maxRunning {};
+    std::atomic_size_t ticks {};
+    std::atomic_size_t arrived {}; // Systems that reached the rendezvous
+    std::atomic_bool rendezvousOver {};
+    std::atomic_bool rendezvousTimedOut {};
+};
+
+// System that records how many systems of its pipeline are ticking at the same time
+template<auto Literal>
+class ConcurrencySystem : public ECS::System<Literal, SamplePipeline>
+{
+public:
+    ConcurrencySystem(ConcurrencyState *state, const bool exclusive = false, const bool rendezvous = false)
+        : _state(state), _exclusive(exclusive), _rendezvous(rendezvous) {}
+
+    [[nodiscard]] bool tick(void) noexcept override
+    {
+        const auto running = ++_state->running;
+        auto maxRunning = _state->maxRunning.load();
+        while (maxRunning < running && !_state->maxRunning.compare_exchange_weak(maxRunning, running));
+        if (_exclusive) {
+            EXPECT_EQ(running, 1);
+        }
+        // Rendezvous systems wait for each other during their first tick, which only succeeds if they tick concurrently
+        if (_rendezvous && !_state->rendezvousOver.load()) {
+            ++_state->arrived;
+            const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (_state->arrived.load() < 2 && std::chrono::steady_clock::now() < timeout)
+                std::this_thread::yield();
+            if (_state->arrived.load() < 2)
+                _state->rendezvousTimedOut = true;
+            _state->rendezvousOver = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        --_state->running;
+        ++_state->ticks;
+        return true;
+    }
+
+private:
+    ConcurrencyState *_state {};
+    bool _exclusive {};
+    bool _rendezvous {};
+};
+
+TEST(Executor, ParallelSystems)
+{
+    using PositionSystem = ConcurrencySystem<"Position"_fixed>;
+    using VelocitySystem = ConcurrencySystem<"Velocity"_fixed>;
+    using RenderSystem = ConcurrencySystem<"Render"_fixed>;
+    ConcurrencyState state;
+
+    ECS::Executor executor(4);
+    executor.addPipeline<SamplePipeline>(60ll);
+    // Position & velocity don't conflict, render reads what both write
+    executor.addSystem<PositionSystem, ECS::Writes<int>>(&state, false, true);
+    executor.addSystem<VelocitySystem, ECS::Writes<float>>(&state, false, true);
+    executor.addSystem<RenderSystem, ECS::Reads<int, float>>(&state, true);
+
+    std::thread thd([&executor] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        executor.stop();
+    });
+    executor.run();
+    if (thd.joinable())
+        thd.join();
+
+    // Position & velocity met during their first tick, render never overlaps (checked by its tick)
+    ASSERT_GT(state.ticks.load(), 0);
+    ASSERT_EQ(state.arrived.load(), 2);
+    ASSERT_FALSE(state.rendezvousTimedOut.load());
+    ASSERT_EQ(state.maxRunning.load(), 2);
+}
+
+TEST(Executor, UndeclaredSystemsRunSequentially)
+{
+    using PositionSystem = ConcurrencySystem<"Position"_fixed>;
+    using VelocitySystem = ConcurrencySystem<"Velocity"_fixed>;
+    using RenderSystem = ConcurrencySystem<"Render"_fixed>;
+    ConcurrencyState state;
+
+    ECS::Executor executor(4);
+    executor.addPipeline<SamplePipeline>(60ll);
+    // Velocity didn't declare its accesses so it conflicts with any system
+    executor.addSystem<PositionSystem, ECS::Writes<int>>(&state, true);
+    executor.addSystem<VelocitySystem>(&state, true);
+    executor.addSystem<RenderSystem, ECS::Reads<float>>(&state, true);
+
+    std::thread thd([&executor] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        executor.stop();
+    });
+    executor.run();
+    if (thd.joinable())
+        thd.join();
+
+    ASSERT_GT(state.ticks.load(), 0);
+    ASSERT_EQ(state.maxRunning.load(), 1);
+}
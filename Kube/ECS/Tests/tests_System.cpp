@@ -222,4 +222,169 @@ TEST(System, StableComponent)
     auto &system = executor.addSystem<StableSystem>();
 
     system.pack<BarB>();
-}
\ No newline at end of file
+}
+
+struct BarC
+{
+    int value {};
+};
+class ViewSystem : public ECS::System<
+    "View", DummyPipeline, Core::DefaultStaticAllocator,
+    BarA, BarB, ECS::StableComponent<BarC>
+>
+{
+public:
+};
+
+TEST(System, View)
+{
+    ECS::Executor executor;
+    executor.addPipeline<DummyPipeline>(60);
+    auto &system = executor.addSystem<ViewSystem>();
+
+    // Every entity has BarA, one out of two has BarB and one out of four has BarC
+    for (int i = 0; i != 16; ++i) {
+        const auto entity = system.add(BarA { i });
+        if (i % 2 == 0)
+            system.attach(entity, BarB { static_cast<float>(i) });
+        if (i % 4 == 0)
+            system.attach(entity, BarC { i });
+    }
+
+    // Iterator over (Entity, BarA &, BarB &)
+    int count {};
+    for (auto [entity, a, b] : system.view<BarA, BarB>()) {
+        ASSERT_EQ(a.value % 2, 0);
+        ASSERT_EQ(static_cast<float>(a.value), b.value);
+        ASSERT_EQ(&a, &system.get<BarA>(entity));
+        ++count;
+    }
+    ASSERT_EQ(count, 8);
+
+    // Smallest table drives the iteration, including stable table tombstones
+    system.dettach<BarC>(system.getTable<BarC>().entities().at(0));
+    count = 0;
+    system.view<BarC, BarA>().each([&count](const BarC &c, const BarA &a) {
+        ASSERT_EQ(c.value, a.value);
+        ++count;
+    });
+    ASSERT_EQ(count, 3);
+
+    // Exclusion filter
+    count = 0;
+    system.view<BarA, BarB>(ECS::Exclude<BarC>).each([&count, &system](const ECS::Entity entity, BarA &a, BarB &) {
+        ASSERT_FALSE(system.exists<BarC>(entity));
+        a.value = -a.value;
+        ++count;
+    });
+    ASSERT_EQ(count, 5);
+
+    // Early exit & const view
+    count = 0;
+    std::as_const(system).view<BarA>(ECS::Exclude<BarB>).each([&count](const BarA &a) {
+        EXPECT_EQ(a.value % 2, 1);
+        return ++count != 4;
+    });
+    ASSERT_EQ(count, 4);
+}
+
+TEST(System, Group)
+{
+    ECS::Executor executor;
+    executor.addPipeline<DummyPipeline>(60);
+    auto &system = executor.addSystem<ViewSystem>();
+
+    const auto isPacked = [&system](const auto &group) {
+        const auto &aEntities = system.getTable<BarA>().entities();
+        const auto &bEntities = system.getTable<BarB>().entities();
+        for (ECS::EntityIndex index {}; index != group.size(); ++index) {
+            if (aEntities.at(index) != bEntities.at(index))
+                return false;
+        }
+        return true;
+    };
+
+    // Entities created before the group are packed on creation
+    for (int i = 0; i != 8; ++i) {
+        const auto entity = system.add(BarA { i });
+        if (i % 2 == 1)
+            system.attach(entity, BarB { static_cast<float>(i) });
+    }
+    auto group = system.group<BarA, BarB>();
+    ASSERT_EQ(group.size(), 4);
+    ASSERT_TRUE(isPacked(group));
+    ASSERT_EQ((system.group<BarA, BarB>().size()), group.size());
+
+    // Attach & dettach move entities in / out of the group
+    const auto entity = system.add(BarB { 42.0f });
+    ASSERT_EQ(group.size(), 4);
+    system.attach(entity, BarA { 42 });
+    ASSERT_EQ(group.size(), 5);
+    ASSERT_TRUE(isPacked(group));
+    system.dettach<BarB>(system.getTable<BarA>().entities().at(0));
+    ASSERT_EQ(group.size(), 4);
+    ASSERT_TRUE(isPacked(group));
+    system.remove(system.getTable<BarB>().entities().at(2));
+    ASSERT_EQ(group.size(), 3);
+    ASSERT_TRUE(isPacked(group));
+    system.attachRange(system.addRange(3), BarA { 7 }, BarB { 7.0f });
+    ASSERT_EQ(group.size(), 6);
+    ASSERT_TRUE(isPacked(group));
+
+    // Group traversal is a linear scan of each owned table
+    int count {};
+    for (auto [entity, a, b] : group) {
+        ASSERT_EQ(static_cast<float>(a.value), b.value);
+        ASSERT_EQ(&a, &system.get<BarA>(entity));
+        ++count;
+    }
+    ASSERT_EQ(count, 6);
+    count = 0;
+    group.each([&count](BarA &a, const BarB &) { a.value = 0; ++count; });
+    ASSERT_EQ(count, 6);
+    ASSERT_EQ(system.view<BarA>(ECS::Exclude<BarB>).sizeHint(), system.getTable<BarA>().count());
+}
+
+TEST(System, VersionedEntity)
+{
+    ECS::Executor executor;
+    executor.addPipeline<DummyPipeline>(60);
+    auto &system = executor.addSystem<FooSystem>();
+
+    ASSERT_FALSE(system.isValid(ECS::NullVersionedEntity));
+
+    // Handle is invalidated when its entity is removed, even if the entity is recycled
+    const auto entity = system.add(Foo { 1 });
+    const auto handle = system.versioned(entity);
+    ASSERT_EQ(handle.entity, entity);
+    ASSERT_TRUE(system.isValid(handle));
+    system.remove(entity);
+    ASSERT_FALSE(system.isValid(handle));
+    const auto recycled = system.add(Foo { 2 });
+    ASSERT_EQ(recycled, entity);
+    ASSERT_FALSE(system.isValid(handle));
+    const auto recycledHandle = system.versioned(recycled);
+    ASSERT_NE(recycledHandle, handle);
+    ASSERT_TRUE(system.isValid(recycledHandle));
+
+    // Range removal invalidates every handle of the range
+    const auto range = system.addRange(4, Foo { 3 });
+    const auto first = system.versioned(range.begin);
+    const auto last = system.versioned(range.end - 1);
+    ASSERT_TRUE(system.isValid(first));
+    ASSERT_TRUE(system.isValid(last));
+    system.removeRange(range);
+    ASSERT_FALSE(system.isValid(first));
+    ASSERT_FALSE(system.isValid(last));
+    ASSERT_TRUE(system.isValid(recycledHandle));
+
+    // Removed entities have no valid handle
+    ASSERT_FALSE(system.isAlive(range.begin));
+    ASSERT_FALSE(system.isValid(system.versioned(range.begin)));
+    ASSERT_FALSE(system.isValid(system.versioned(ECS::NullEntity)));
+    const auto removed = system.add(Foo { 4 });
+    system.remove(removed);
+    ASSERT_FALSE(system.isAlive(removed));
+    ASSERT_FALSE(system.isValid(system.versioned(removed)));
+    ASSERT_TRUE(system.isAlive(recycled));
+}
@@ -0,0 +1,136 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: View
+ */
+
+#pragma once
+
+#include <array>
+#include <tuple>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    namespace Internal
+    {
+        /** @brief Components excluded from a view */
+        template<typename ...Components>
+        struct TagExclude {};
+    }
+
+    /** @brief Helper used to exclude entities having any of the given components from a view */
+    template<typename ...Components>
+    constexpr auto Exclude = Internal::TagExclude<Components...>();
+
+    template<typename IncludedTables, typename ExcludedTables>
+    class View;
+}
+
+/** @brief View over the entities that have every component of 'Tables' and none of 'ExcludedTables'
+ *  @note Iteration is driven by the smallest table, other tables are probed through their index sparse set
+ *  @note Tables must not be structurally modified (add / remove) while the view is traversed */
+template<typename ...Tables, typename ...ExcludedTables>
+class kF::ECS::View<std::tuple<Tables...>, std::tuple<ExcludedTables...>>
+{
+public:
+    static_assert(sizeof...(Tables) != 0, "ECS::View: A view requires at least one component");
+
+    /** @brief Number of joined tables */
+    static constexpr std::size_t TableCount = sizeof...(Tables);
+
+    /** @brief Unstable indexes of an entity inside each joined table */
+    using Indexes = std::array<EntityIndex, TableCount>;
+
+    /** @brief Value yielded by the view iterator */
+    using Value = std::tuple<Entity, decltype(std::declval<Tables &>().atIndex(EntityIndex {})) ...>;
+
+
+    /** @brief Iterator over joined entities */
+    class Iterator
+    {
+    public:
+        /** @brief Value constructor */
+        inline Iterator(View * const view, const Entity * const it) noexcept : _view(view), _it(it) { seek(); }
+
+        /** @brief Copy constructor */
+        inline Iterator(const Iterator &other) noexcept = default;
+
+        /** @brief Copy assignment */
+        inline Iterator &operator=(const Iterator &other) noexcept = default;
+
+
+        /** @brief Dereference iterator */
+        [[nodiscard]] inline Value operator*(void) const noexcept { return _view->makeValue(*_it, _indexes); }
+
+
+        /** @brief Prefix increment operator */
+        inline Iterator &operator++(void) noexcept { ++_it; seek(); return *this; }
+
+        /** @brief Postfix increment operator */
+        [[nodiscard]] inline Iterator operator++(int) noexcept { const auto past = *this; ++*this; return past; }
+
+
+        /** @brief Equal operators */
+        [[nodiscard]] inline bool operator==(const Iterator &other) const noexcept { return _it == other._it; }
+        [[nodiscard]] inline bool operator!=(const Iterator &other) const noexcept { return _it != other._it; }
+
+    private:
+        /** @brief Advance until an entity matches the view */
+        inline void seek(void) noexcept
+            { while (_it != _view->_end && !_view->match(*_it, _indexes)) ++_it; }
+
+        View *_view {};
+        const Entity *_it {};
+        Indexes _indexes {};
+    };
+
+
+    /** @brief Construct the view from joined and excluded tables */
+    View(Tables &...tables, const ExcludedTables &...excludedTables) noexcept;
+
+    /** @brief Copy constructor */
+    View(const View &other) noexcept = default;
+
+    /** @brief Copy assignment */
+    View &operator=(const View &other) noexcept = default;
+
+
+    /** @brief Get the upper bound of the number of entities in the view */
+    [[nodiscard]] inline EntityIndex sizeHint(void) const noexcept { return static_cast<EntityIndex>(_end - _begin); }
+
+
+    /** @brief Begin / end iterators, yielding (Entity, Components &...) tuples */
+    [[nodiscard]] inline Iterator begin(void) noexcept { return Iterator(this, _begin); }
+    [[nodiscard]] inline Iterator end(void) noexcept { return Iterator(this, _end); }
+
+
+    /** @brief Traverse the view with a callback taking (Entity, Components &...) as arguments or only (Components &...)
+     *  @note If the callback returns a boolean, traversal is stopped when 'false' is returned */
+    template<typename Callback>
+    void each(Callback &&callback) noexcept;
+
+private:
+    /** @brief Traverse the view knowing its driving table at compile time */
+    template<std::size_t DriverIndex, typename Callback>
+    void eachImpl(Callback &callback) noexcept;
+
+    /** @brief Check if an entity matches the view and query its indexes */
+    [[nodiscard]] bool match(const Entity entity, Indexes &indexes) const noexcept;
+
+    /** @brief Build the value of an entity */
+    [[nodiscard]] Value makeValue(const Entity entity, const Indexes &indexes) const noexcept;
+
+    /** @brief Invoke a callback with an entity and its components, returns false if traversal must stop */
+    template<typename Callback>
+    [[nodiscard]] bool invoke(Callback &callback, const Entity entity, const Indexes &indexes) const noexcept;
+
+
+    std::tuple<Tables *...> _tables {};
+    std::tuple<const ExcludedTables *...> _excludedTables {};
+    const Entity *_begin {};
+    const Entity *_end {};
+    std::size_t _driverIndex {};
+};
+
+#include "View.ipp"
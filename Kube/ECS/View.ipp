@@ -0,0 +1,135 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: View
+ */
+
+#include "View.hpp"
+
+template<typename ...Tables, typename ...ExcludedTables>
+inline kF::ECS::View<std::tuple<Tables...>, std::tuple<ExcludedTables...>>::View(Tables &...tables, const ExcludedTables &...excludedTables) noexcept
+    : _tables(&tables...), _excludedTables(&excludedTables...)
+{
+    // Find the smallest table, the stored entity count is used as stable tables may contain tombstones
+    EntityIndex minCount = NullEntityIndex;
+    [this, &minCount]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+        const auto select = [this, &minCount]<std::size_t Index>(std::integral_constant<std::size_t, Index>) {
+            const auto &entities = std::get<Index>(_tables)->entities();
+            if (entities.size() < minCount) {
+                minCount = entities.size();
+                _begin = entities.begin();
+                _end = entities.end();
+                _driverIndex = Index;
+            }
+        };
+        (select(std::integral_constant<std::size_t, Indexes>()), ...);
+    }(std::make_index_sequence<TableCount>());
+}
+
+template<typename ...Tables, typename ...ExcludedTables>
+template<typename Callback>
+inline void kF::ECS::View<std::tuple<Tables...>, std::tuple<ExcludedTables...>>::each(Callback &&callback) noexcept
+{
+    // Dispatch the driving table at compile time so it doesn't have to be probed
+    [this, &callback]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+        ((_driverIndex == Indexes ? (eachImpl<Indexes>(callback), true) : false) || ...);
+    }(std::make_index_sequence<TableCount>());
+}
+
+template<typename ...Tables, typename ...ExcludedTables>
+template<std::size_t DriverIndex, typename Callback>
+inline void kF::ECS::View<std::tuple<Tables...>, std::tuple<ExcludedTables...>>::eachImpl(Callback &callback) noexcept
+{
+    Indexes indexes {};
+
+    for (EntityIndex index {}, count = static_cast<EntityIndex>(_end - _begin); index != count; ++index) {
+        const auto entity = _begin[index];
+
+        // Skip tombstones of stable tables
+        if constexpr (std::tuple_element_t<DriverIndex, std::tuple<Tables...>>::IsStable) {
+            if (entity == NullEntity) [[unlikely]]
+                continue;
+        }
+
+        // Probe other tables
+        const bool matched = [this, entity, index, &indexes]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+            const auto probe = [this, entity, index, &indexes]<std::size_t Index>(std::integral_constant<std::size_t, Index>) {
+                if constexpr (Index == DriverIndex) {
+                    indexes[Index] = index;
+                    return true;
+                } else {
+                    indexes[Index] = std::get<Index>(_tables)->getUnstableIndex(entity);
+                    return indexes[Index] != NullEntityIndex;
+                }
+            };
+            return (probe(std::integral_constant<std::size_t, Indexes>()) && ...);
+        }(std::make_index_sequence<TableCount>());
+        if (!matched)
+            continue;
+
+        // Check exclusions
+        if constexpr (sizeof...(ExcludedTables) != 0) {
+            const bool excluded = std::apply([entity](const auto * const ...excludedTables) {
+                return (excludedTables->exists(entity) || ...);
+            }, _excludedTables);
+            if (excluded)
+                continue;
+        }
+
+        if (!invoke(callback, entity, indexes))
+            break;
+    }
+}
+
+template<typename ...Tables, typename ...ExcludedTables>
+inline bool kF::ECS::View<std::tuple<Tables...>, std::tuple<ExcludedTables...>>::match(const Entity entity, Indexes &indexes) const noexcept
+{
+    if (entity == NullEntity) [[unlikely]]
+        return false;
+
+    const bool matched = [this, entity, &indexes]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+        return ((indexes[Indexes] = std::get<Indexes>(_tables)->getUnstableIndex(entity), indexes[Indexes] != NullEntityIndex) && ...);
+    }(std::make_index_sequence<TableCount>());
+
+    if constexpr (sizeof...(ExcludedTables) != 0) {
+        return matched && !std::apply([entity](const auto * const ...excludedTables) {
+            return (excludedTables->exists(entity) || ...);
+        }, _excludedTables);
+    } else
+        return matched;
+}
+
+template<typename ...Tables, typename ...ExcludedTables>
+inline typename kF::ECS::View<std::tuple<Tables...>, std::tuple<ExcludedTables...>>::Value
+    kF::ECS::View<std::tuple<Tables...>, std::tuple<ExcludedTables...>>::makeValue(const Entity entity, const Indexes &indexes) const noexcept
+{
+    return [this, entity, &indexes]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+        return Value(entity, std::get<Indexes>(_tables)->atIndex(indexes[Indexes])...);
+    }(std::make_index_sequence<TableCount>());
+}
+
+template<typename ...Tables, typename ...ExcludedTables>
+template<typename Callback>
+inline bool kF::ECS::View<std::tuple<Tables...>, std::tuple<ExcludedTables...>>::invoke(Callback &callback, const Entity entity, const Indexes &indexes) const noexcept
+{
+    return [this, &callback, entity, &indexes]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+        // Entity & Components
+        if constexpr (std::is_invocable_v<Callback &, Entity, decltype(std::get<Indexes>(_tables)->atIndex(EntityIndex {}))...>) {
+            using Result = std::invoke_result_t<Callback &, Entity, decltype(std::get<Indexes>(_tables)->atIndex(EntityIndex {}))...>;
+            if constexpr (std::is_same_v<Result, bool>)
+                return callback(entity, std::get<Indexes>(_tables)->atIndex(indexes[Indexes])...);
+            else {
+                callback(entity, std::get<Indexes>(_tables)->atIndex(indexes[Indexes])...);
+                return true;
+            }
+        // Components only
+        } else {
+            using Result = std::invoke_result_t<Callback &, decltype(std::get<Indexes>(_tables)->atIndex(EntityIndex {}))...>;
+            if constexpr (std::is_same_v<Result, bool>)
+                return callback(std::get<Indexes>(_tables)->atIndex(indexes[Indexes])...);
+            else {
+                callback(std::get<Indexes>(_tables)->atIndex(indexes[Indexes])...);
+                return true;
+            }
+        }
+    }(std::make_index_sequence<TableCount>());
+}
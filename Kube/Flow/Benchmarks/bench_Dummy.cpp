@@ -1,13 +0,0 @@
-/**
- * @ Author: Matthieu Moinvaziri
- * @ Description: Benchmark of Flow
- */
-
-#include <benchmark/benchmark.h>
-
-static void Flow_Dummy(benchmark::State &state)
-{
-    for (auto _ : state) {
-    }
-}
-BENCHMARK(Flow_Dummy);
@@ -0,0 +1,65 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of Flow parallel algorithms
+ */
+
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Flow/Parallel.hpp>
+
+using namespace kF;
+
+/** @brief Number of elements processed per iteration */
+constexpr std::size_t ElementCount = 1'000'000;
+
+static void Flow_ParallelFor_Sequential(benchmark::State &state)
+{
+    std::vector<float> values(ElementCount, 1.0f);
+
+    for (auto _ : state) {
+        for (auto &value : values)
+            value = value * 0.5f + 1.0f;
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ElementCount));
+}
+BENCHMARK(Flow_ParallelFor_Sequential);
+
+static void Flow_ParallelFor(benchmark::State &state)
+{
+    Flow::Scheduler scheduler(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> values(ElementCount, 1.0f);
+
+    for (auto _ : state) {
+        Flow::ParallelFor(scheduler, 0ul, ElementCount, 4096ul, [&values](const std::size_t from, const std::size_t to) {
+            for (auto i = from; i != to; ++i)
+                values[i] = values[i] * 0.5f + 1.0f;
+        });
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ElementCount));
+}
+BENCHMARK(Flow_ParallelFor)->UseRealTime()->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()));
+
+static void Flow_ParallelReduce(benchmark::State &state)
+{
+    Flow::Scheduler scheduler(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> values(ElementCount, 1.0f);
+
+    for (auto _ : state) {
+        const auto sum = Flow::ParallelReduce(scheduler, 0ul, ElementCount, 4096ul, 0.0,
+            [&values](const std::size_t from, const std::size_t to) {
+                double value {};
+                for (auto i = from; i != to; ++i)
+                    value += values[i];
+                return value;
+            },
+            [](const double lhs, const double rhs) { return lhs + rhs; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ElementCount));
+}
+BENCHMARK(Flow_ParallelReduce)->UseRealTime()->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()));
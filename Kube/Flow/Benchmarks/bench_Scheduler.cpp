@@ -0,0 +1,191 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of Flow Scheduler
+ */
+
+#include <array>
+#include <chrono>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Platform.hpp>
+
+#if KUBE_PLATFORM_WINDOWS
+# include <windows.h>
+#else
+# include <sys/resource.h>
+#endif
+
+#include <Kube/Flow/Scheduler.hpp>
+#include <Kube/Flow/Graph.hpp>
+
+using namespace kF;
+
+/** @brief Busy work, the cost grows with 'units' */
+static void SpinWork(const std::size_t units) noexcept
+{
+    std::size_t value { units };
+    for (std::size_t i = 0; i != units * 64; ++i)
+        benchmark::DoNotOptimize(value = value * 31 + i);
+}
+
+/** @brief Build a fan-out / fan-in graph: a root task spawns 'Width' tasks joined by a single task
+ *  Children are all pushed into the local queue of the worker executing the root, other workers must steal them
+ *  When 'Unbalanced' is true, the cost of a child depends on its index so stealing the oldest tasks matters */
+template<std::size_t Width, bool Unbalanced>
+static void BuildFanOutFanIn(Flow::Graph &graph) noexcept
+{
+    auto &root = graph.add([] {});
+    auto &join = graph.add([] {});
+
+    for (std::size_t i = 0; i != Width; ++i) {
+        const auto units = Unbalanced ? 1 + (i % 16) * 4 : 32;
+        graph.add([units] { SpinWork(units); }).after(root).before(join);
+    }
+}
+
+#define FLOW_FANOUT_FANIN(Width, Unbalanced) \
+static void Flow_FanOutFanIn_##Width##_##Unbalanced(benchmark::State &state) \
+{ \
+    Flow::Scheduler scheduler(static_cast<std::size_t>(state.range(0))); \
+    Flow::Graph graph; \
+    BuildFanOutFanIn<Width, Unbalanced>(graph); \
+    for (auto _ : state) { \
+        scheduler.schedule(graph); \
+        graph.waitSpin(); \
+    } \
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Width)); \
+} \
+BENCHMARK(Flow_FanOutFanIn_##Width##_##Unbalanced)->UseRealTime()->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()));
+
+FLOW_FANOUT_FANIN(64, false)
+FLOW_FANOUT_FANIN(64, true)
+FLOW_FANOUT_FANIN(1024, false)
+FLOW_FANOUT_FANIN(1024, true)
+
+/** @brief Fan-out / fan-in over all hardware threads, reporting the locality of successful steals */
+template<kF::Flow::Scheduler::WorkerPlacement Placement>
+static void Flow_StealLocality(benchmark::State &state)
+{
+    constexpr std::size_t Width = 1024;
+
+    Flow::Scheduler scheduler(Flow::Scheduler::AutoWorkerCount, Flow::Scheduler::DefaultTaskQueueSize, Placement);
+    Flow::Graph graph;
+    BuildFanOutFanIn<Width, true>(graph);
+    for (auto _ : state) {
+        scheduler.schedule(graph);
+        graph.waitSpin();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Width));
+
+    // Report steal ratio per locality
+    const auto stats = scheduler.stealStats();
+    double steals {};
+    for (const auto count : stats)
+        steals += static_cast<double>(count);
+    steals = std::max(steals, 1.0);
+    state.counters["SameCache"] = static_cast<double>(stats[static_cast<std::size_t>(Flow::Scheduler::StealLocality::SameCache)]) / steals;
+    state.counters["SameNode"] = static_cast<double>(stats[static_cast<std::size_t>(Flow::Scheduler::StealLocality::SameNode)]) / steals;
+    state.counters["Remote"] = static_cast<double>(stats[static_cast<std::size_t>(Flow::Scheduler::StealLocality::Remote)]) / steals;
+    state.counters["StealsPerIteration"] = steals / static_cast<double>(std::max<benchmark::IterationCount>(state.iterations(), 1));
+}
+BENCHMARK_TEMPLATE(Flow_StealLocality, kF::Flow::Scheduler::WorkerPlacement::Unpinned)->UseRealTime();
+BENCHMARK_TEMPLATE(Flow_StealLocality, kF::Flow::Scheduler::WorkerPlacement::Pinned)->UseRealTime();
+
+/** @brief Re-execute an unmodified layered graph of empty tasks, measuring the per-tick overhead of the scheduler
+ *  Each task of a layer is linked to every task of the next one */
+static void Flow_ReExecute(benchmark::State &state)
+{
+    constexpr std::size_t LayerCount = 16;
+    constexpr std::size_t Width = 16;
+
+    Flow::Scheduler scheduler(static_cast<std::size_t>(state.range(0)));
+    Flow::Graph graph;
+    std::array<Flow::Task *, Width> previous {};
+    for (std::size_t layer = 0; layer != LayerCount; ++layer) {
+        std::array<Flow::Task *, Width> current {};
+        for (auto &task : current) {
+            task = &graph.add([] {});
+            if (layer) {
+                for (const auto parent : previous)
+                    task->after(*parent);
+            }
+        }
+        previous = current;
+    }
+    graph.compile();
+    for (auto _ : state) {
+        scheduler.schedule(graph);
+        graph.waitSpin();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * LayerCount * Width));
+}
+BENCHMARK(Flow_ReExecute)->UseRealTime()->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()));
+
+
+/** @brief Get the CPU time consumed by all threads of the process in nanoseconds */
+static std::int64_t GetProcessCpuTime(void) noexcept
+{
+#if KUBE_PLATFORM_WINDOWS
+    FILETIME creation {}, exit {}, kernel {}, user {};
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+    const auto toNs = [](const FILETIME &time) {
+        return static_cast<std::int64_t>((static_cast<std::uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) * 100;
+    };
+    return toNs(kernel) + toNs(user);
+#else
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    const auto toNs = [](const timeval &time) {
+        return static_cast<std::int64_t>(time.tv_sec) * 1'000'000'000 + static_cast<std::int64_t>(time.tv_usec) * 1'000;
+    };
+    return toNs(usage.ru_stime) + toNs(usage.ru_utime);
+#endif
+}
+
+/** @brief Tick a small fan-out / fan-in graph at 1 kHz, the way a game loop would
+ *  Reports the wake-up latency (from schedule to the root task start) and the CPU used by the process,
+ *  which is mostly made of idle workers spinning before parking */
+static void Flow_Tick1kHz(benchmark::State &state)
+{
+    constexpr std::size_t Width = 8;
+    constexpr auto TickPeriod = std::chrono::milliseconds(1);
+
+    Flow::Scheduler scheduler(static_cast<std::size_t>(state.range(0)));
+    Flow::Graph graph;
+    std::chrono::steady_clock::time_point scheduleTime {};
+    std::int64_t latency {};
+    std::int64_t maxLatency {};
+    auto &root = graph.add([&scheduleTime, &latency, &maxLatency] {
+        const auto wakeLatency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - scheduleTime).count();
+        latency += wakeLatency;
+        maxLatency = std::max(maxLatency, wakeLatency);
+    });
+    auto &join = graph.add([] {});
+    for (std::size_t i = 0; i != Width; ++i)
+        graph.add([] { SpinWork(16); }).after(root).before(join);
+    graph.compile();
+
+    // The graph is awaited on the next tick so that the calling thread sleeps instead of spinning
+    const auto wallBegin = std::chrono::steady_clock::now();
+    const auto cpuBegin = GetProcessCpuTime();
+    auto tick = wallBegin;
+    for (auto _ : state) {
+        tick += TickPeriod;
+        std::this_thread::sleep_until(tick);
+        graph.waitSpin();
+        scheduleTime = std::chrono::steady_clock::now();
+        scheduler.schedule(graph);
+    }
+    graph.waitSpin();
+    const auto cpuTime = static_cast<double>(GetProcessCpuTime() - cpuBegin);
+    const auto wallTime = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wallBegin).count());
+
+    const auto ticks = static_cast<double>(std::max<benchmark::IterationCount>(state.iterations(), 1));
+    state.counters["WakeLatencyNs"] = static_cast<double>(latency) / ticks;
+    state.counters["MaxWakeLatencyNs"] = static_cast<double>(maxLatency);
+    state.counters["CpuUsage"] = cpuTime / std::max(wallTime, 1.0); // In cores
+    state.counters["CpuPerTickNs"] = cpuTime / ticks;
+}
+BENCHMARK(Flow_Tick1kHz)->UseRealTime()->Iterations(1000)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()));
@@ -0,0 +1,55 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flow coroutine task
+ */
+
+#include <Kube/Core/Abort.hpp>
+
+#include "Scheduler.hpp"
+#include "Graph.hpp"
+
+using namespace kF;
+
+void Flow::CoTask::promise_type::unhandled_exception(void) noexcept
+{
+    kFAbort("Flow::CoTask: Unhandled exception inside coroutine");
+}
+
+bool Flow::GraphAwaiter::await_ready(void) const noexcept
+{
+    return !graph.count();
+}
+
+bool Flow::GraphAwaiter::await_suspend(const CoTask::Handle handle) const noexcept
+{
+    auto &promise = handle.promise();
+
+    return promise.scheduler->scheduleAwait(graph, *promise.task);
+}
+
+void Flow::SleepAwaiter::await_suspend(const CoTask::Handle handle) const noexcept
+{
+    auto &promise = handle.promise();
+
+    promise.scheduler->scheduleAfter(*promise.task, durationNs);
+}
+
+bool Flow::EventAwaiter::await_suspend(const CoTask::Handle handle) const noexcept
+{
+    auto &promise = handle.promise();
+    auto expected = CoEvent::EmptyState;
+
+    // If the event is set meanwhile, the coroutine is resumed immediately
+    event._scheduler = promise.scheduler;
+    return event._state.compare_exchange_strong(expected, reinterpret_cast<std::uintptr_t>(promise.task),
+        std::memory_order_acq_rel, std::memory_order_acquire);
+}
+
+void Flow::CoEvent::set(void) noexcept
+{
+    const auto state = _state.exchange(SetState, std::memory_order_acq_rel);
+
+    // Schedule the waiting coroutine task
+    if (state != EmptyState && state != SetState)
+        _scheduler->schedule(*reinterpret_cast<Task *>(state));
+}
@@ -0,0 +1,203 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flow coroutine task
+ */
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <utility>
+
+#include "Base.hpp"
+
+namespace kF::Flow
+{
+    class CoTask;
+    class CoEvent;
+    class Task;
+    class Graph;
+    class Scheduler;
+
+    struct GraphAwaiter;
+    struct SleepAwaiter;
+    struct EventAwaiter;
+
+    /** @brief Suspend the calling coroutine until 'graph' is over, 'graph' is scheduled by the awaiting coroutine */
+    [[nodiscard]] inline GraphAwaiter operator co_await(Graph &graph) noexcept;
+
+    /** @brief Suspend the calling coroutine during at least 'durationNs' nanoseconds */
+    [[nodiscard]] inline SleepAwaiter SleepFor(const std::int64_t durationNs) noexcept;
+}
+
+/** @brief Coroutine returned by a coroutine task work
+ *  A coroutine task is started by a worker and suspends without blocking it when awaiting a graph, a sleep or an event
+ *  Its task is scheduled again once the awaited operation is over and is completed when the coroutine returns
+ *  Example:
+ *      graph.add([&]() -> Flow::CoTask {
+ *          co_await loadGraph;
+ *          co_await Flow::SleepFor(1'000'000);
+ *          co_await ioEvent;
+ *      });
+ */
+class [[nodiscard]] kF::Flow::CoTask
+{
+public:
+    struct promise_type;
+
+    /** @brief Coroutine handle */
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /** @brief Coroutine promise, only accessed by the worker resuming the coroutine */
+    struct promise_type
+    {
+        Scheduler *scheduler {}; // Scheduler executing the coroutine
+        Task *task {}; // Task owning the coroutine
+        bool *completed {}; // Set to true when the coroutine returns (points to the stack of the resuming worker)
+
+        /** @brief Coroutine frames are allocated using FlowAllocator */
+        [[nodiscard]] static inline void *operator new(const std::size_t size) noexcept
+            { return FlowAllocator::Allocate(size, alignof(std::max_align_t)); }
+
+        /** @brief Coroutine frames are deallocated using FlowAllocator */
+        static inline void operator delete(void * const data, const std::size_t size) noexcept
+            { FlowAllocator::Deallocate(data, size, alignof(std::max_align_t)); }
+
+        /** @brief Get an empty coroutine on allocation failure */
+        [[nodiscard]] static inline CoTask get_return_object_on_allocation_failure(void) noexcept { return CoTask(); }
+
+        /** @brief Get the coroutine of the promise */
+        [[nodiscard]] inline CoTask get_return_object(void) noexcept { return CoTask(Handle::from_promise(*this)); }
+
+        /** @brief Coroutines are started by workers */
+        [[nodiscard]] inline std::suspend_always initial_suspend(void) const noexcept { return {}; }
+
+        /** @brief Coroutines are destroyed by the worker that resumed them last */
+        [[nodiscard]] inline std::suspend_always final_suspend(void) const noexcept { return {}; }
+
+        /** @brief Notify the resuming worker that the coroutine is over */
+        inline void return_void(void) noexcept { *completed = true; }
+
+        /** @brief Exceptions are not supported */
+        [[noreturn]] void unhandled_exception(void) noexcept;
+    };
+
+
+    /** @brief Destructor */
+    inline ~CoTask(void) noexcept { if (_handle) _handle.destroy(); }
+
+    /** @brief Default constructor */
+    inline CoTask(void) noexcept = default;
+
+    /** @brief Handle constructor */
+    inline explicit CoTask(const Handle handle) noexcept : _handle(handle) {}
+
+    /** @brief Move constructor */
+    inline CoTask(CoTask &&other) noexcept : _handle(std::exchange(other._handle, Handle {})) {}
+
+    /** @brief Move assignment */
+    inline CoTask &operator=(CoTask &&other) noexcept { std::swap(_handle, other._handle); return *this; }
+
+
+    /** @brief Release the ownership of the coroutine handle */
+    [[nodiscard]] inline Handle release(void) noexcept { return std::exchange(_handle, Handle {}); }
+
+private:
+    Handle _handle {};
+};
+
+/** @brief Awaiter of a graph */
+struct kF::Flow::GraphAwaiter
+{
+    Graph &graph;
+
+    /** @brief Empty graphs do not suspend */
+    [[nodiscard]] bool await_ready(void) const noexcept;
+
+    /** @brief Schedule the graph, the coroutine task is scheduled again once the graph is over */
+    [[nodiscard]] bool await_suspend(const CoTask::Handle handle) const noexcept;
+
+    /** @brief Nothing to return */
+    inline void await_resume(void) const noexcept {}
+};
+
+/** @brief Awaiter of a sleep */
+struct kF::Flow::SleepAwaiter
+{
+    std::int64_t durationNs {};
+
+    /** @brief Null durations do not suspend */
+    [[nodiscard]] inline bool await_ready(void) const noexcept { return durationNs <= 0; }
+
+    /** @brief Register the coroutine task into the timers of its scheduler */
+    void await_suspend(const CoTask::Handle handle) const noexcept;
+
+    /** @brief Nothing to return */
+    inline void await_resume(void) const noexcept {}
+};
+
+/** @brief One shot event that a single coroutine can await, it can be set from any thread (ex: IO completion callback) */
+class kF::Flow::CoEvent
+{
+public:
+    /** @brief Destructor */
+    inline ~CoEvent(void) noexcept = default;
+
+    /** @brief Default constructor */
+    inline CoEvent(void) noexcept = default;
+
+    /** @brief CoEvent is not copiable */
+    CoEvent(const CoEvent &other) noexcept = delete;
+    CoEvent &operator=(const CoEvent &other) noexcept = delete;
+
+
+    /** @brief Check if the event is set */
+    [[nodiscard]] inline bool isSet(void) const noexcept { return _state.load(std::memory_order_acquire) == SetState; }
+
+    /** @brief Set the event, scheduling the waiting coroutine task if any */
+    void set(void) noexcept;
+
+    /** @brief Reset the event so it can be awaited again
+     *  @note No coroutine must be waiting */
+    inline void reset(void) noexcept { _state.store(EmptyState, std::memory_order_relaxed); }
+
+
+    /** @brief Await the event */
+    [[nodiscard]] inline EventAwaiter operator co_await(void) noexcept;
+
+private:
+    friend EventAwaiter;
+
+    /** @brief State of an event without waiter */
+    static constexpr std::uintptr_t EmptyState = 0;
+
+    /** @brief State of a set event */
+    static constexpr std::uintptr_t SetState = 1;
+
+    std::atomic<std::uintptr_t> _state { EmptyState }; // Either EmptyState, SetState or the address of the waiting task
+    Scheduler *_scheduler {}; // Scheduler of the waiting task
+};
+
+/** @brief Awaiter of an event */
+struct kF::Flow::EventAwaiter
+{
+    CoEvent &event;
+
+    /** @brief Set events do not suspend */
+    [[nodiscard]] inline bool await_ready(void) const noexcept { return event.isSet(); }
+
+    /** @brief Register the coroutine task as the waiter of the event */
+    [[nodiscard]] bool await_suspend(const CoTask::Handle handle) const noexcept;
+
+    /** @brief Nothing to return */
+    inline void await_resume(void) const noexcept {}
+};
+
+inline kF::Flow::GraphAwaiter kF::Flow::operator co_await(Graph &graph) noexcept
+    { return GraphAwaiter { .graph = graph }; }
+
+inline kF::Flow::SleepAwaiter kF::Flow::SleepFor(const std::int64_t durationNs) noexcept
+    { return SleepAwaiter { .durationNs = durationNs }; }
+
+inline kF::Flow::EventAwaiter kF::Flow::CoEvent::operator co_await(void) noexcept
+    { return EventAwaiter { .event = *this }; }
@@ -3,12 +3,15 @@
  * @ Description: Flow graph
  */
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <thread>
 
 #include <Kube/Core/Abort.hpp>
 
 #include "Graph.hpp"
+#include "Trace.hpp"
 
 using namespace kF;
 
@@ -17,7 +20,7 @@ Flow::Graph::~Graph(void) noexcept
     waitSleep();
 }
 
-const Flow::TaskRefList &Flow::Graph::prepareToSchedule(void) noexcept
+const Flow::TaskRefList &Flow::Graph::prepareToSchedule(Task * const continuation) noexcept
 {
     { // Ensure that the graph is not running
         const auto count = _activeTaskCount.load(std::memory_order_acquire);
@@ -25,30 +28,44 @@ const Flow::TaskRefList &Flow::Graph::prepareToSchedule(void) noexcept
             "Flow::Graph::prepareToSchedule: Graph is already running with ", count, " active tasks");
     }
 
-    _activeTaskCount.store(_tasks.size(), std::memory_order_relaxed);
-    if (!_preparedTasks.empty()) [[likely]] {
-        for (auto &task : _tasks)
-            task->prepareToSchedule();
-    } else {
-        for (auto &task : _tasks) {
-            task->prepareToSchedule();
-            if (!task->linkedFrom().empty()) [[likely]]
-                continue;
-            else
-                _preparedTasks.push(task.get());
-        }
-    }
+    // An extra count keeps the graph running until the last joiner is done with it
+    _activeTaskCount.store(_tasks.empty() ? 0 : _tasks.size() + 1, std::memory_order_relaxed);
+    _continuation = continuation;
+    // A nested graph never runs at a lower priority than its parent graph
+    _schedulePriority = _priority;
+    if (continuation && continuation->parent())
+        _schedulePriority = std::min(_schedulePriority, continuation->parent()->schedulePriority());
+    // Only join counters need to be reset once the graph is compiled
+    if (!compiled()) [[unlikely]]
+        compile();
+    if (!_tasks.empty()) [[likely]]
+        std::memset(_compiledData.data(), 0, _tasks.size() * sizeof(std::uint32_t));
     _beginExecutionTimestamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
     return _preparedTasks;
 }
 
-void Flow::Graph::joinTasks(const std::size_t taskCount) noexcept
+Flow::Task *Flow::Graph::joinTasks(const std::size_t taskCount, TraceBuffer * const trace) noexcept
 {
     // The last worker is ending graph execution
-    if (_activeTaskCount.fetch_sub(taskCount, std::memory_order_acq_rel) == taskCount) [[unlikely]] {
-        _lastExecutionTime = std::chrono::high_resolution_clock::now().time_since_epoch().count() - _beginExecutionTimestamp;
+    if (_activeTaskCount.fetch_sub(taskCount, std::memory_order_acq_rel) == taskCount + 1) [[unlikely]] {
+        const auto endExecutionTimestamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        _lastExecutionTime = endExecutionTimestamp - _beginExecutionTimestamp;
         _medianExecutionTime = (_medianExecutionTime + _lastExecutionTime) / 2;
+        if (trace) [[unlikely]] {
+            trace->push(TraceEvent {
+                .begin = _beginExecutionTimestamp,
+                .end = endExecutionTimestamp,
+                .name = _name,
+                .object = this,
+                .type = TraceEventType::Graph
+            });
+        }
+        const auto continuation = _continuation;
+        // From now on the graph may be rescheduled or destroyed
+        _activeTaskCount.store(0, std::memory_order_release);
+        return continuation;
     }
+    return nullptr;
 }
 
 void Flow::Graph::remove(Task &task) noexcept
@@ -66,9 +83,48 @@ void Flow::Graph::clear(void) noexcept
     _tasks.clear();
 }
 
+void Flow::Graph::compile(void) noexcept
+{
+    const auto taskCount = _tasks.size();
+
+    _preparedTasks.clear();
+    _successors.clear();
+    if (!taskCount) [[unlikely]] {
+        _compiledData.release();
+        return;
+    }
+    _compiledData.allocate(3 * taskCount + 1, 0u);
+
+    // Index tasks and count links
+    std::uint32_t linkCount {};
+    for (std::uint32_t index {}; auto &task : _tasks) {
+        task->_index = index++;
+        linkCount += task->linkedTo().size();
+    }
+
+    // Store successors back to back, keeping the link order used by switch tasks
+    const auto inDegrees = _compiledData.data() + taskCount;
+    const auto offsets = inDegrees + taskCount;
+    _successors.reserve(linkCount);
+    for (auto &task : _tasks) {
+        offsets[task->_index] = _successors.size();
+        inDegrees[task->_index] = task->linkedFrom().size();
+        for (Task * const link : task->linkedTo()) {
+            kFEnsure(link->parent() == this,
+                "Flow::Graph::compile: Task is linked to a task of another graph");
+            _successors.push(link);
+        }
+        if (task->linkedFrom().empty())
+            _preparedTasks.push(task.get());
+    }
+    offsets[taskCount] = _successors.size();
+}
+
 void Flow::Graph::invalidateScheduleCacheImpl(void) noexcept
 {
     _preparedTasks.clear();
+    _successors.clear();
+    _compiledData.release();
 }
 
 void Flow::Graph::waitSleep(const std::int64_t sleepNs) noexcept
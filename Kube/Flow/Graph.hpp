@@ -5,17 +5,26 @@
 
 #pragma once
 
+#include <Kube/Core/HeapArray.hpp>
+
 #include "Task.hpp"
 
 namespace kF::Flow
 {
     class Graph;
+    class TraceBuffer;
 
     /** @brief Unique pointer over Graph */
     using GraphPtr = Core::UniquePtr<Graph, FlowAllocator>;
+
+    /** @brief Range of compiled task references */
+    using TaskRange = Core::IteratorRange<Task * const *>;
 }
 
-/** @brief Task based graph */
+/** @brief Task based graph
+ *  Before its first execution (or the first one following a modification), the graph is compiled into contiguous arrays:
+ *  successors of every task stored back to back (CSR layout), in-degrees, join counters and root tasks
+ *  Re-executing an unmodified graph only resets its join counters, without any allocation */
 class alignas_cacheline kF::Flow::Graph
 {
 public:
@@ -29,6 +38,10 @@ public:
     /** @brief Default constructor */
     inline Graph(void) noexcept = default;
 
+    /** @brief Graph is not copiable */
+    Graph(const Graph &other) noexcept = delete;
+    Graph &operator=(const Graph &other) noexcept = delete;
+
 
     /** @brief Check if graph is running */
     [[nodiscard]] inline bool running(void) const noexcept { return _activeTaskCount.load(std::memory_order_acquire); }
@@ -61,6 +74,30 @@ public:
     [[nodiscard]] inline std::uint32_t count(void) const noexcept { return _tasks.size(); }
 
 
+    /** @brief Check if the graph is compiled */
+    [[nodiscard]] inline bool compiled(void) const noexcept { return !_compiledData.empty(); }
+
+    /** @brief Compile the graph links, this is done automatically by the first schedule following a modification
+     *  Adding, removing or linking tasks invalidates the compiled graph */
+    void compile(void) noexcept;
+
+
+    /** @brief Get the name of the graph used by traces, null if not set */
+    [[nodiscard]] inline const char *name(void) const noexcept { return _name; }
+
+    /** @brief Set the name of the graph used by traces
+     *  @note The name must be null-terminated and outlive the graph (ex: string literal) */
+    inline void setName(const char * const name) noexcept { _name = name; }
+
+
+    /** @brief Get scheduling priority of the graph tasks */
+    [[nodiscard]] inline TaskPriority priority(void) const noexcept { return _priority; }
+
+    /** @brief Set scheduling priority of the graph tasks
+     *  @note A graph executed by a graph task inherits the priority of its parent graph if more urgent */
+    inline void setPriority(const TaskPriority priority) noexcept { _priority = priority; }
+
+
     /** @brief Get last execution time in nanoseconds */
     [[nodiscard]] inline std::int64_t lastExecutionTime(void) const noexcept { return _lastExecutionTime; }
 
@@ -88,32 +125,55 @@ public: // Unsafe public functions reserved for workers
     /**
      * @brief Prepare current graph to schedule setting its state to running
      * ! Only call this function before scheduling the graph
+     * @param continuation The task to complete once the graph is over (used when executed by a graph task)
      * @return TaskRefList The list of tasks to schedule
      */
-    [[nodiscard]] const TaskRefList &prepareToSchedule(void) noexcept;
+    [[nodiscard]] const TaskRefList &prepareToSchedule(Task * const continuation = nullptr) noexcept;
+
+
+    /** @brief Decrement counter of active tasks by taskCount
+     *  @param trace If not null, records the graph execution once over
+     *  @return The continuation task if this call completed the graph, else nullptr */
+    [[nodiscard]] Task *joinTasks(const std::size_t taskCount, TraceBuffer * const trace = nullptr) noexcept;
 
+    /** @brief Get the effective priority of the graph tasks since last 'prepareToSchedule' call */
+    [[nodiscard]] inline TaskPriority schedulePriority(void) const noexcept { return _schedulePriority; }
 
-    /** @brief Decrement counter of active tasks by taskCount */
-    void joinTasks(const std::size_t taskCount) noexcept;
+
+    /** @brief Get the compiled successors of a task, in the same order as its 'linkedTo' list */
+    [[nodiscard]] inline TaskRange successors(const Task &task) const noexcept;
+
+    /** @brief Join a compiled task once for one of its completed predecessors
+     *  @return true The task is ready to get executed
+     *  @return false The task still have unexecuted dependencies */
+    [[nodiscard]] inline bool tryJoinTask(const Task &task) noexcept;
+
+
+    /** @brief Invalidate schedule cache so it must be re-prepared */
+    inline void invalidateScheduleCache(void) noexcept { if (compiled()) [[unlikely]] invalidateScheduleCacheImpl(); }
 
 
 private:
     // Cacheline 0
     TaskList _tasks {}; // Children task instances
     TaskRefList _preparedTasks {}; // Tasks prepared to run
-    std::atomic_size_t _activeTaskCount { 0 }; // Number of active tasks
-    std::int64_t _beginExecutionTimestamp {}; // Timestamp of execution begin
+    std::atomic_size_t _activeTaskCount { 0 }; // Number of active tasks (+1 while running, released once execution times are written)
+    Task *_continuation {}; // Task to complete once the graph is over
+    TaskPriority _priority { TaskPriority::Normal }; // Priority of the graph tasks
+    TaskPriority _schedulePriority { TaskPriority::Normal }; // Effective priority of the running graph tasks
+    const char *_name {}; // Name used by traces
+    // Cacheline 1
+    alignas_cacheline std::int64_t _beginExecutionTimestamp {}; // Timestamp of execution begin
     std::int64_t _lastExecutionTime {}; // Last execution time
     std::int64_t _medianExecutionTime {}; // Median execution time
-
-
-    /** @brief Invalidate schedule cache so it must be re-prepared */
-    inline void invalidateScheduleCache(void) noexcept { if (!_preparedTasks.empty()) [[unlikely]] invalidateScheduleCacheImpl(); }
+    Core::HeapArray<std::uint32_t, FlowAllocator> _compiledData {}; // Join counts [0, n[, in-degrees [n, 2n[ and successor offsets [2n, 3n]
+    TaskRefList _successors {}; // Successors of each task stored back to back
 
     /** @brief This function extends invalidateScheduleCache in order to reduce inline footprint on the likely path */
     void invalidateScheduleCacheImpl(void) noexcept;
 };
 
-static_assert_fit_cacheline(kF::Flow::Graph);
+static_assert_alignof_cacheline(kF::Flow::Graph);
+static_assert_sizeof(kF::Flow::Graph, kF::Core::CacheLineSize * 2);
 
 #include "Graph.ipp"
\ No newline at end of file
@@ -38,3 +38,17 @@ inline kF::Flow::Task &kF::Flow::Graph::add(ClassType &&instance) noexcept
     work.template prepare<MemberFunction>(std::forward<ClassType>(instance));
     return *_tasks.push(TaskPtr::Make(*this, std::move(work)));
 }
+
+inline kF::Flow::TaskRange kF::Flow::Graph::successors(const Task &task) const noexcept
+{
+    const auto offsets = _compiledData.data() + 2 * _tasks.size();
+    const auto data = _successors.data();
+    return TaskRange { data + offsets[task.index()], data + offsets[task.index() + 1] };
+}
+
+inline bool kF::Flow::Graph::tryJoinTask(const Task &task) noexcept
+{
+    const auto index = task.index();
+    const auto inDegree = _compiledData[_tasks.size() + index];
+    return std::atomic_ref(_compiledData[index]).fetch_add(1, std::memory_order_acq_rel) + 1 == inDegree;
+}
@@ -0,0 +1,62 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flow data parallel algorithms
+ */
+
+#pragma once
+
+#include "Scheduler.hpp"
+#include "Graph.hpp"
+
+namespace kF::Flow
+{
+    namespace Internal
+    {
+        /** @brief Range shared by the tasks of a parallel algorithm
+         *  Blocks are claimed with a guided size: half of the remaining work per worker, never less than the grain size
+         *  Early claims are large to limit contention, late claims shrink so that workers finish together
+         *  Tasks claim blocks until the range is exhausted, so a worker stealing a task also steals the remaining work */
+        template<std::integral Index>
+        struct alignas_cacheline ParallelRange
+        {
+            std::atomic<Index> next {};
+            Index end {};
+            Index grainSize {};
+            Index divisor {};
+
+            /** @brief Claim the next block of the range */
+            [[nodiscard]] inline bool claim(Index &from, Index &to) noexcept;
+        };
+
+        /** @brief Run 'taskCount' tasks on 'scheduler' plus one on the calling thread, then wait for all of them
+         *  'body' is called with the index of the task in range [0, taskCount], 'taskCount' being the calling thread */
+        template<typename Body>
+        void ParallelRun(Scheduler &scheduler, const std::size_t taskCount, Body &body) noexcept;
+
+        /** @brief Get the number of tasks to schedule for a range (the calling thread excluded) */
+        template<std::integral Index>
+        [[nodiscard]] inline std::size_t GetParallelTaskCount(const Scheduler &scheduler, const Index begin, const Index end, const Index grainSize) noexcept;
+    }
+
+    /** @brief Call 'functor(from, to)' over disjoint blocks covering [begin, end[ in parallel
+     *  The calling thread takes part to the work, when it is a worker of 'scheduler' it never blocks and executes other tasks while waiting
+     *  @note The range is not recursively split through 'TaskContext::spawn' on purpose: spawning requires a running task while
+     *        algorithms may be called from any thread, and would allocate a task per split. Guided claiming only schedules one task
+     *        per worker and still balances the load, as a stolen task keeps claiming the remaining blocks
+     *  @param grainSize Minimum size of a block (a range no larger than the grain size is processed inline) */
+    template<std::integral Index, typename Functor>
+        requires std::invocable<Functor &, Index, Index>
+    void ParallelFor(Scheduler &scheduler, const Index begin, const Index end, const Index grainSize, Functor &&functor) noexcept;
+
+    /** @brief Reduce [begin, end[ in parallel, each block is mapped with 'functor(from, to)' then merged with 'reducer(lhs, rhs)'
+     *  The order of reduction is unspecified so 'reducer' must be associative and commutative
+     *  The calling thread takes part to the work, when it is a worker of 'scheduler' it never blocks and executes other tasks while waiting
+     *  @param grainSize Minimum size of a block (a range no larger than the grain size is processed inline)
+     *  @param identity Initial value of each partial reduction */
+    template<std::integral Index, typename Value, typename Functor, typename Reducer>
+        requires std::invocable<Functor &, Index, Index> && std::invocable<Reducer &, Value, Value>
+    [[nodiscard]] Value ParallelReduce(Scheduler &scheduler, const Index begin, const Index end, const Index grainSize,
+            const Value &identity, Functor &&functor, Reducer &&reducer) noexcept;
+}
+
+#include "Parallel.ipp"
@@ -0,0 +1,111 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flow data parallel algorithms
+ */
+
+#include <Kube/Core/HeapArray.hpp>
+
+#include "Parallel.hpp"
+
+template<std::integral Index>
+inline bool kF::Flow::Internal::ParallelRange<Index>::claim(Index &from, Index &to) noexcept
+{
+    auto current = next.load(std::memory_order_relaxed);
+
+    while (current < end) {
+        const Index remaining = end - current;
+        const Index size = std::min(remaining, std::max(grainSize, static_cast<Index>(remaining / divisor)));
+        if (next.compare_exchange_weak(current, static_cast<Index>(current + size), std::memory_order_relaxed)) [[likely]] {
+            from = current;
+            to = static_cast<Index>(current + size);
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename Body>
+inline void kF::Flow::Internal::ParallelRun(Scheduler &scheduler, const std::size_t taskCount, Body &body) noexcept
+{
+    Graph graph;
+
+    for (std::size_t i = 0; i != taskCount; ++i)
+        graph.add([&body, i] { body(i); });
+    scheduler.schedule(graph);
+    body(taskCount);
+    scheduler.wait(graph);
+}
+
+template<std::integral Index>
+inline std::size_t kF::Flow::Internal::GetParallelTaskCount(const Scheduler &scheduler, const Index begin, const Index end, const Index grainSize) noexcept
+{
+    if (end <= begin) [[unlikely]]
+        return 0;
+    const auto count = static_cast<std::size_t>(end - begin);
+    const auto grain = static_cast<std::size_t>(std::max(grainSize, static_cast<Index>(1)));
+    const auto blockCount = (count + grain - 1) / grain;
+    return std::min(scheduler.workerCount(), blockCount - 1);
+}
+
+template<std::integral Index, typename Functor>
+    requires std::invocable<Functor &, Index, Index>
+inline void kF::Flow::ParallelFor(Scheduler &scheduler, const Index begin, const Index end, const Index grainSize, Functor &&functor) noexcept
+{
+    const auto taskCount = Internal::GetParallelTaskCount(scheduler, begin, end, grainSize);
+
+    // Small range, process inline
+    if (!taskCount) {
+        if (begin < end) [[likely]]
+            functor(begin, end);
+        return;
+    }
+
+    Internal::ParallelRange<Index> range {
+        .next = begin,
+        .end = end,
+        .grainSize = std::max(grainSize, static_cast<Index>(1)),
+        .divisor = static_cast<Index>((taskCount + 1) * 2)
+    };
+    auto body = [&range, &functor](const std::size_t) {
+        Index from {}, to {};
+        while (range.claim(from, to))
+            functor(from, to);
+    };
+    Internal::ParallelRun(scheduler, taskCount, body);
+}
+
+template<std::integral Index, typename Value, typename Functor, typename Reducer>
+    requires std::invocable<Functor &, Index, Index> && std::invocable<Reducer &, Value, Value>
+inline Value kF::Flow::ParallelReduce(Scheduler &scheduler, const Index begin, const Index end, const Index grainSize,
+        const Value &identity, Functor &&functor, Reducer &&reducer) noexcept
+{
+    const auto taskCount = Internal::GetParallelTaskCount(scheduler, begin, end, grainSize);
+
+    // Small range, process inline
+    if (!taskCount) {
+        if (begin < end) [[likely]]
+            return reducer(identity, functor(begin, end));
+        return identity;
+    }
+
+    Internal::ParallelRange<Index> range {
+        .next = begin,
+        .end = end,
+        .grainSize = std::max(grainSize, static_cast<Index>(1)),
+        .divisor = static_cast<Index>((taskCount + 1) * 2)
+    };
+    Core::HeapArray<Value, FlowAllocator> partials(static_cast<std::uint32_t>(taskCount + 1), identity);
+    auto body = [&range, &functor, &reducer, &partials](const std::size_t taskIndex) {
+        auto &partial = partials[static_cast<std::uint32_t>(taskIndex)];
+        Index from {}, to {};
+        while (range.claim(from, to))
+            partial = reducer(std::move(partial), functor(from, to));
+    };
+    Internal::ParallelRun(scheduler, taskCount, body);
+
+    // Merge partial reductions
+    Value result = std::move(partials[0]);
+    for (std::uint32_t i = 1; i != partials.size(); ++i)
+        result = reducer(std::move(result), std::move(partials[i]));
+    return result;
+}
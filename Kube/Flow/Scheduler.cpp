@@ -5,24 +5,103 @@
 
 
 #include <Kube/Core/Abort.hpp>
+#include <Kube/Core/CpuTopology.hpp>
 #include <Kube/Core/Random.hpp>
 
 #include "Scheduler.hpp"
 #include "Graph.hpp"
+#include "TaskContext.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <ostream>
 
 using namespace kF;
 
+/** @brief Scheduler owning the calling worker thread */
+static thread_local const Flow::Scheduler *CurrentScheduler {};
+
+/** @brief Cache of the calling worker thread */
+static thread_local Flow::Scheduler::WorkerCache *CurrentWorkerCache {};
+
+/** @brief Steal the most urgent task of a worker */
+[[nodiscard]] static bool StealWorkerQueues(Flow::Scheduler::WorkerQueue * const queues, Flow::Task *&task) noexcept
+{
+    for (std::size_t priority = 0; priority != Flow::TaskPriorityCount; ++priority) {
+        if (queues[priority].steal(task))
+            return true;
+    }
+    return false;
+}
+
+/** @brief Get current timestamp of timers in nanoseconds */
+[[nodiscard]] static std::int64_t GetTimerTimestamp(void) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/** @brief Compare timers to build a min heap */
+[[nodiscard]] static bool CompareTimers(const Flow::Scheduler::Timer &lhs, const Flow::Scheduler::Timer &rhs) noexcept
+{
+    return lhs.timestamp > rhs.timestamp;
+}
+
+/** @brief Get the priority of a task from its parent graph or the task that spawned it */
+[[nodiscard]] static Flow::TaskPriority GetTaskPriority(const Flow::Task &task) noexcept
+{
+    if (const auto parent = task.parent(); parent) [[likely]]
+        return parent->schedulePriority();
+    else if (const auto group = task.spawnGroup(); group)
+        return group->priority;
+    else
+        return Flow::TaskPriority::Normal;
+}
+
+/** @brief Get the successors of a task, using the compiled links of its parent graph if any */
+[[nodiscard]] static Flow::TaskRange GetTaskSuccessors(const Flow::Task &task) noexcept
+{
+    if (const auto parent = task.parent(); parent) [[likely]]
+        return parent->successors(task);
+    else
+        return Flow::TaskRange { task.linkedTo().begin(), task.linkedTo().end() };
+}
+
+/** @brief Join a task once, using the compiled join counters of its parent graph if any */
+[[nodiscard]] static bool TryJoinTask(Flow::Task &task) noexcept
+{
+    if (const auto parent = task.parent(); parent) [[likely]]
+        return parent->tryJoinTask(task);
+    else
+        return task.tryJoin();
+}
+
 Flow::Scheduler::~Scheduler(void) noexcept
 {
     _running.store(false, std::memory_order_relaxed);
-    _notifier.release(static_cast<ptrdiff_t>(workerCount())); // Release all sleeping workers (Scheduler enter into non-reusable state)
+    if (_timers) {
+        {
+            std::lock_guard lock(_timers->mutex);
+            _timers->running = false;
+        }
+        _timers->condition.notify_one();
+        _timers->thread.join();
+    }
+    for (auto &queue : _taskQueues)
+        queue.close(); // Release all producers waiting for a free slot
+    // Wake up all parked workers (Scheduler enter into non-reusable state)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (std::uint32_t worker = 0; worker != _parkers.size(); ++worker)
+        wakeWorker(worker);
     for (auto &thd : _threads)
         thd.join();
 }
 
-Flow::Scheduler::Scheduler(const std::size_t workerCount, const std::size_t taskQueueSize) noexcept
-    : _taskQueue(taskQueueSize)
+Flow::Scheduler::Scheduler(const std::size_t workerCount, const std::size_t taskQueueSize, const WorkerPlacement placement) noexcept
+    : _taskQueues { TaskQueue(taskQueueSize), TaskQueue(taskQueueSize), TaskQueue(taskQueueSize) }
 {
+    static_assert(TaskPriorityCount == 3, "Flow::Scheduler: Task queues initialization must match TaskPriorityCount");
+
     // Find worker count
     auto count = workerCount;
     if (count == AutoWorkerCount)
@@ -30,26 +109,132 @@ Flow::Scheduler::Scheduler(const std::size_t workerCount, const std::size_t task
     if (!count)
         count = DefaultWorkerCount;
 
-    _workers.allocate(static_cast<std::uint32_t>(count), taskQueueSize);
+    _workers.allocate(static_cast<std::uint32_t>(count * TaskPriorityCount), taskQueueSize);
     _threads.allocate(static_cast<std::uint32_t>(count));
+    _parkedWorkers.allocate(static_cast<std::uint32_t>((count + 63) / 64), 0ull);
+    _parkers.allocate(static_cast<std::uint32_t>(count));
+    setupWorkerLocalities(placement);
 
     std::uint32_t workerIndex { 0u };
     for (auto &thd : _threads) {
-        thd = std::thread([this, workerIndex] {
+        thd = std::thread([this, workerIndex, pin = placement == WorkerPlacement::Pinned] {
+            if (pin)
+                Core::CpuTopology::PinCurrentThread(_localities[workerIndex].cpu);
             runWorker(workerIndex);
         });
         ++workerIndex;
     }
 }
 
+void Flow::Scheduler::setupWorkerLocalities(const WorkerPlacement placement) noexcept
+{
+    const auto count = static_cast<std::uint32_t>(workerCount());
+
+    _localities.allocate(count);
+    _victims.allocate(count * count);
+
+    // Unpinned workers have a single remote locality containing all workers
+    if (placement == WorkerPlacement::Unpinned) {
+        for (std::uint32_t worker = 0; worker != count; ++worker) {
+            _localities[worker].victimEnds = { 0u, 0u, count };
+            for (std::uint32_t victim = 0; victim != count; ++victim)
+                _victims[worker * count + victim] = victim;
+        }
+        return;
+    }
+
+    // Assign CPUs in topology order, so that consecutive workers share caches
+    const auto topology = Core::CpuTopology::Discover();
+    const auto &cpus = topology.cpus();
+    const auto getLocality = [&cpus](const std::uint32_t lhs, const std::uint32_t rhs) {
+        const auto &lhsCpu = cpus[lhs % cpus.size()];
+        const auto &rhsCpu = cpus[rhs % cpus.size()];
+        if (lhsCpu.cacheGroup == rhsCpu.cacheGroup)
+            return StealLocality::SameCache;
+        else if (lhsCpu.node == rhsCpu.node)
+            return StealLocality::SameNode;
+        else
+            return StealLocality::Remote;
+    };
+
+    for (std::uint32_t worker = 0; worker != count; ++worker) {
+        auto &locality = _localities[worker];
+        const auto victims = &_victims[worker * count];
+        std::uint32_t victimCount {};
+        locality.cpu = cpus[worker % cpus.size()].index;
+        // The worker itself always comes first, then victims are sorted by locality
+        victims[victimCount++] = worker;
+        for (std::size_t index = 0; index != StealLocalityCount; ++index) {
+            for (std::uint32_t victim = 0; victim != count; ++victim) {
+                if (victim != worker && getLocality(worker, victim) == static_cast<StealLocality>(index))
+                    victims[victimCount++] = victim;
+            }
+            locality.victimEnds[index] = victimCount;
+        }
+    }
+}
+
+Flow::Scheduler::StealStats Flow::Scheduler::stealStats(void) const noexcept
+{
+    StealStats stats {};
+
+    for (const auto &locality : _localities) {
+        for (std::size_t index = 0; index != StealLocalityCount; ++index)
+            stats[index] += locality.steals[index].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void Flow::Scheduler::startTracing(const std::size_t capacity) noexcept
+{
+    if (_traceBuffers.empty())
+        _traceBuffers.allocate(static_cast<std::uint32_t>(workerCount()), capacity);
+    _activeTraceBuffers.store(_traceBuffers.data(), std::memory_order_release);
+}
+
+void Flow::Scheduler::collectTrace(const std::size_t workerIndex, TraceEventList &events) noexcept
+{
+    if (!_traceBuffers.empty()) [[likely]]
+        _traceBuffers[static_cast<std::uint32_t>(workerIndex)].collect(events);
+}
+
+void Flow::Scheduler::exportChromeTrace(std::ostream &stream) noexcept
+{
+    TraceEventList events;
+
+    stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (std::size_t worker = 0; worker != workerCount(); ++worker) {
+        // Name each worker thread
+        stream << (worker ? "," : "") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << worker
+            << ",\"args\":{\"name\":\"Worker " << worker << "\"}}";
+        events.clear();
+        collectTrace(worker, events);
+        for (const auto &event : events) {
+            stream << ',';
+            WriteChromeTraceEvent(stream, event, worker);
+        }
+    }
+    stream << "]}";
+}
+
 void Flow::Scheduler::schedule(Graph &graph) noexcept
 {
     auto &tasks = graph.prepareToSchedule();
     // Ensure the graph is not empty before scheduling
     if (!tasks.empty()) [[likely]] {
-        for (const auto task : tasks) {
-            while (!_taskQueue.push(task))
-                std::this_thread::yield();
+        auto &queue = taskQueue(graph.schedulePriority());
+        auto it = tasks.begin();
+        const auto end = tasks.end();
+        while (true) {
+            // Insert as much as possible at once
+            it += queue.pushRange(it, end);
+            if (it == end) [[likely]]
+                break;
+            // Notify workers before blocking so they can free some slots
+            notifyWorker();
+            if (!queue.pushWait(*it)) [[unlikely]]
+                return;
+            ++it;
         }
         notifyWorker();
     }
@@ -57,18 +242,144 @@ void Flow::Scheduler::schedule(Graph &graph) noexcept
 
 void Flow::Scheduler::schedule(Task &task) noexcept
 {
-    while (!_taskQueue.push(&task))
-        std::this_thread::yield();
+    auto &queue = taskQueue(GetTaskPriority(task));
+    if (!queue.push(&task)) [[unlikely]] {
+        notifyWorker();
+        if (!queue.pushWait(&task)) [[unlikely]]
+            return;
+    }
+    notifyWorker();
+}
+
+void Flow::Scheduler::wait(Graph &graph) noexcept
+{
+    const auto cache = currentWorkerCache();
+
+    // Outside of workers we can only spin
+    if (!cache) {
+        graph.waitSpin();
+        return;
+    }
+
+    // Help other workers until the graph is over
+    while (graph.running())
+        helpWorker(*cache);
+}
+
+void Flow::Scheduler::helpWorker(WorkerCache &cache) noexcept
+{
+    if (popWorkerTask(cache)) [[likely]]
+        executeWorkerTask(cache);
+    else if (const auto target = Core::Random::Generate32(static_cast<std::uint32_t>(workerCount())); target != cache.index
+            && StealWorkerQueues(&_workers[static_cast<std::uint32_t>(target * TaskPriorityCount)], cache.task))
+        executeWorkerTask(cache);
+    else
+        Core::CpuRelax();
+}
+
+Flow::Scheduler::WorkerCache *Flow::Scheduler::currentWorkerCache(void) const noexcept
+{
+    return CurrentScheduler == this ? CurrentWorkerCache : nullptr;
+}
+
+void Flow::Scheduler::scheduleAfter(Task &task, const std::int64_t delayNs) noexcept
+{
+    std::call_once(_timersOnce, [this] {
+        _timers = Core::UniquePtr<TimerQueue, FlowAllocator>::Make();
+        _timers->thread = std::thread([this] { runTimers(); });
+    });
+
+    const auto timestamp = GetTimerTimestamp() + delayNs;
+    bool earliest {};
+    {
+        std::lock_guard lock(_timers->mutex);
+        _timers->timers.push(Timer { .timestamp = timestamp, .task = &task });
+        std::push_heap(_timers->timers.begin(), _timers->timers.end(), &CompareTimers);
+        earliest = _timers->timers.front().task == &task;
+    }
+    // Only wake up the timer thread if its wait deadline changed
+    if (earliest)
+        _timers->condition.notify_one();
+}
+
+void Flow::Scheduler::runTimers(void) noexcept
+{
+    auto &queue = *_timers;
+    std::unique_lock lock(queue.mutex);
+
+    while (queue.running) {
+        if (queue.timers.empty()) {
+            queue.condition.wait(lock);
+            continue;
+        }
+        // Wait until the earliest timer is reached
+        const auto timestamp = queue.timers.front().timestamp;
+        if (const auto now = GetTimerTimestamp(); timestamp > now) {
+            queue.condition.wait_for(lock, std::chrono::nanoseconds(timestamp - now));
+            continue;
+        }
+        std::pop_heap(queue.timers.begin(), queue.timers.end(), &CompareTimers);
+        const auto task = queue.timers.back().task;
+        queue.timers.pop();
+        lock.unlock();
+        schedule(*task);
+        lock.lock();
+    }
+}
+
+bool Flow::Scheduler::scheduleAwait(Graph &graph, Task &coroutineTask) noexcept
+{
+    auto &tasks = graph.prepareToSchedule(&coroutineTask);
+    if (tasks.empty()) [[unlikely]]
+        return false;
+
+    // Coroutines are resumed by workers, so tasks should be pushed into the local queue of the calling worker
+    if (const auto cache = currentWorkerCache(); cache) [[likely]] {
+        scheduleWorkerTasks(*cache, graph.schedulePriority(), tasks.begin(), tasks.end());
+        return true;
+    }
+    auto &queue = taskQueue(graph.schedulePriority());
+    for (const auto task : tasks) {
+        if (!queue.push(task)) [[unlikely]] {
+            notifyWorker();
+            if (!queue.pushWait(task)) [[unlikely]]
+                break;
+        }
+    }
     notifyWorker();
+    return true;
+}
+
+void Flow::Scheduler::spawnWorkerTask(WorkerCache &cache, Task &owner, TaskGroup *&group, Task &task) noexcept
+{
+    // The owner holds an extra count on its group until its work returns
+    if (!group) [[unlikely]] {
+        group = new (FlowAllocator::Allocate(sizeof(TaskGroup), alignof(TaskGroup))) TaskGroup {
+            .owner = &owner,
+            .priority = GetTaskPriority(owner)
+        };
+    }
+    group->pendingCount.fetch_add(1, std::memory_order_relaxed);
+    task.setSpawnGroup(group);
+
+    // Tasks are spawned one at a time, wake up a sleeping worker to steal them if there is no thief
+    const auto begin = &task;
+    scheduleWorkerTasks(cache, group->priority, &begin, &begin + 1);
+    if (_stealWorkerCount.load(std::memory_order_acquire) == 0
+            && _activeWorkerCount.load(std::memory_order_acquire) < workerCount()) [[unlikely]]
+        notifyWorker();
 }
 
 void Flow::Scheduler::runWorker(const std::uint32_t workerIndex) noexcept
 {
     WorkerCache cache {
         .index = workerIndex,
-        .queue = _workers[workerIndex]
+        .queues = &_workers[static_cast<std::uint32_t>(workerIndex * TaskPriorityCount)]
     };
 
+    CurrentScheduler = this;
+    CurrentWorkerCache = &cache;
+
     while (true) {
         // If a task is found, start execution
         if (cache.task != nullptr) [[likely]] {
@@ -88,42 +399,13 @@ void Flow::Scheduler::runWorker(const std::uint32_t workerIndex) noexcept
     }
 }
 
-bool Flow::Scheduler::observeWorkerPendingGraphs(WorkerCache &cache) noexcept
-{
-    // Iterate over each graph, select completed ones
-    bool hasScheduled = false;
-    auto it = std::remove_if(cache.pendingGraphs.begin(), cache.pendingGraphs.end(),
-        [this, &cache, &hasScheduled](PendingGraph &pending) {
-            // If the graph is running, do nothing
-            if (pending.graph->running()) [[likely]]
-                return false;
-
-            // Notify end of task
-            pending.task->parent()->joinTasks(1u);
-
-            // Schedule linked tasks
-            if (auto &linkedTo = pending.task->linkedTo(); !linkedTo.empty()) [[likely]] {
-                hasScheduled = true;
-                scheduleWorkerLinkedTasks(cache, linkedTo.begin(), linkedTo.end());
-            }
-            return true;
-        }
-    );
-    // Remove completed graphs
-    if (it != cache.pendingGraphs.end()) [[unlikely]]
-        cache.pendingGraphs.erase(it, cache.pendingGraphs.end());
-    return hasScheduled;
-}
-
 void Flow::Scheduler::executeWorkerQueue(WorkerCache &cache) noexcept
 {
     while (true) {
         // Execute if this worker is the only running
         if (cache.task) [[likely]]
             executeWorkerTask(cache);
-        if (!cache.pendingGraphs.empty()) [[unlikely]]
-            observeWorkerPendingGraphs(cache);
-        if (!cache.queue.pop(cache.task)) [[unlikely]] // No more task in queue, stop execution
+        if (!popWorkerTask(cache)) [[unlikely]] // No more task available, stop execution
             break;
     }
 }
@@ -134,6 +416,13 @@ void Flow::Scheduler::executeWorkerTask(WorkerCache &cache) noexcept
     auto task = cache.task;
     cache.task = nullptr;
     std::size_t switchIndex { SIZE_MAX };
+    bool completed { true };
+
+    // Record execution begin, the task must not be accessed after a suspended coroutine
+    const auto trace = traceBuffer(cache);
+    TraceEvent event {};
+    if (trace) [[unlikely]]
+        event = TraceEvent { .begin = GetTraceTimestamp(), .name = task->name(), .object = task, .type = TraceEventType::Task };
 
     // Execute task
     switch (auto &work = task->work(); work.type) {
@@ -143,20 +432,82 @@ void Flow::Scheduler::executeWorkerTask(WorkerCache &cache) noexcept
     case Task::WorkType::Switch:
         switchIndex = work.switchWork();
         break;
+    case Task::WorkType::Context:
+    {
+        // If the work spawned tasks, the task is completed by the last one
+        TaskContext context(*this, cache, *task);
+        work.contextWork(context);
+        completed = context.release();
+        break;
+    }
     case Task::WorkType::Graph:
-        // If the graph contains tasks, add it to pending list and setup task range
-        if (auto &tasks = work.graphWork->prepareToSchedule(); !tasks.empty()) [[likely]] {
-            scheduleWorkerTasks(cache, tasks.begin(), tasks.end());
-            cache.pendingGraphs.push(PendingGraph { .task = task, .graph = work.graphWork });
-            return;
+        // If the graph contains tasks, schedule them, the task is completed by the last task of the graph
+        if (auto &tasks = work.graphWork->prepareToSchedule(task); !tasks.empty()) [[likely]] {
+            scheduleWorkerTasks(cache, work.graphWork->schedulePriority(), tasks.begin(), tasks.end());
+            completed = false;
         }
         break;
+    case Task::WorkType::Coroutine:
+        // If the coroutine suspends, the task is completed by the worker that resumes it last
+        completed = resumeWorkerCoroutine(*task);
+        break;
     default:
         break;
     }
 
+    if (trace) [[unlikely]] {
+        event.end = GetTraceTimestamp();
+        trace->push(event);
+    }
+    if (completed) [[likely]]
+        completeWorkerTask(cache, *task, switchIndex);
+}
+
+bool Flow::Scheduler::resumeWorkerCoroutine(Task &task) noexcept
+{
+    auto &work = task.work().coroutineWork;
+
+    // Start the coroutine
+    if (!work.handle) [[unlikely]] {
+        work.handle = work.factory().release();
+        kFEnsure(work.handle, "Flow::Scheduler::resumeWorkerCoroutine: Couldn't allocate coroutine");
+    }
+
+    // Resume the coroutine, once suspended it may already be resumed by another worker so it must not be accessed anymore
+    const auto handle = work.handle;
+    bool completed { false };
+    auto &promise = handle.promise();
+    promise.scheduler = this;
+    promise.task = &task;
+    promise.completed = &completed;
+    handle.resume();
+    if (!completed)
+        return false;
+
+    // The coroutine is over, destroy it
+    work.handle = CoTask::Handle {};
+    handle.destroy();
+    return true;
+}
+
+void Flow::Scheduler::completeWorkerTask(WorkerCache &cache, Task &task, const std::size_t switchIndex) noexcept
+{
+    // A spawned task has no successor, the last one of its group completes the task that spawned it
+    if (const auto group = task.spawnGroup(); group) [[unlikely]] {
+        kFEnsure(switchIndex == SIZE_MAX || switchIndex == 0,
+            "Flow::Scheduler::executeWorkerTask: Spawned task returned switch index '", switchIndex, "' but has no linked task");
+        task.~Task();
+        FlowAllocator::Deallocate(&task, sizeof(Task), alignof(Task));
+        if (group->pendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            const auto owner = group->owner;
+            FlowAllocator::Deallocate(group, sizeof(TaskGroup), alignof(TaskGroup));
+            completeWorkerTask(cache, *owner, SIZE_MAX);
+        }
+        return;
+    }
+
     // Ensure switchIndex is valid given linked tasks
-    auto &linkedTo = task->linkedTo();
+    const auto linkedTo = GetTaskSuccessors(task);
     kFEnsure(switchIndex == SIZE_MAX || switchIndex <= linkedTo.size(),
         "Flow::Scheduler::executeWorkerTask: Task returned switch index '", switchIndex,
         "' but only has '", linkedTo.size(), "' linked tasks");
@@ -182,35 +533,55 @@ void Flow::Scheduler::executeWorkerTask(WorkerCache &cache) noexcept
     }
 
     // Notify end of tasks
-    if (const auto parent = task->parent(); parent)
-        parent->joinTasks(joinedTasks);
+    if (const auto parent = task.parent(); parent)
+        joinWorkerGraph(cache, *parent, joinedTasks);
 
     // Schedule target linked tasks
     if (begin != end) [[likely]]
-        scheduleWorkerLinkedTasks(cache, begin, end);
+        scheduleWorkerLinkedTasks(cache, GetTaskPriority(task), begin, end);
+}
+
+void Flow::Scheduler::joinWorkerGraph(WorkerCache &cache, Graph &graph, const std::size_t taskCount) noexcept
+{
+    const auto continuation = graph.joinTasks(taskCount, traceBuffer(cache));
+
+    if (!continuation) [[likely]]
+        return;
+    // The graph is awaited by a coroutine task, schedule it again to resume the coroutine
+    else if (continuation->work().type == Task::WorkType::Coroutine)
+        scheduleWorkerTasks(cache, GetTaskPriority(*continuation), &continuation, &continuation + 1);
+    // The graph is over, complete the graph task that executed it
+    else
+        completeWorkerTask(cache, *continuation, SIZE_MAX);
 }
 
 void Flow::Scheduler::joinWorkerConditionalTask(WorkerCache &cache, Task * const task, std::size_t &joinCount) noexcept
 {
     // If a task couldn't be joined, it means the task is connected to other sources
-    if (!task->tryJoin()) [[likely]]
+    if (!TryJoinTask(*task)) [[likely]]
         return;
     ++joinCount;
-    for (const auto link : task->linkedTo())
+    for (const auto link : GetTaskSuccessors(*task))
         joinWorkerConditionalTask(cache, link, joinCount);
 }
 
-void Flow::Scheduler::scheduleWorkerTasks(WorkerCache &cache, Task * const *begin, Task * const *end) noexcept
+void Flow::Scheduler::scheduleWorkerTasks(WorkerCache &cache, const TaskPriority priority, Task * const *begin, Task * const *end) noexcept
 {
+    auto &workerQueue = cache.queue(priority);
+    auto &globalQueue = taskQueue(priority);
+
     while (true) {
-        // Insert as much as possible into worker queue
-        begin += cache.queue.pushRange(begin, end);
+        // Insert as much as possible into worker queue, wake up a sleeping worker to steal if more than one task is pushed
+        const auto pushed = workerQueue.pushRange(begin, end);
+        begin += pushed;
+        if (pushed > 1 && _stealWorkerCount.load(std::memory_order_acquire) == 0
+                && _activeWorkerCount.load(std::memory_order_acquire) < workerCount()) [[unlikely]]
+            notifyWorker();
         if (begin == end) [[likely]]
             break;
 
         // Insert as much as possible into global queue
-        while (begin != end && _taskQueue.push(*begin)) [[likely]]
-            ++begin;
+        begin += globalQueue.pushRange(begin, end);
         if (begin == end) [[likely]]
             break;
 
@@ -219,18 +590,18 @@ void Flow::Scheduler::scheduleWorkerTasks(WorkerCache &cache, Task * const *begi
     }
 }
 
-void Flow::Scheduler::scheduleWorkerLinkedTasks(WorkerCache &cache, Task * const *begin, Task * const *end) noexcept
+void Flow::Scheduler::scheduleWorkerLinkedTasks(WorkerCache &cache, const TaskPriority priority, Task * const *begin, Task * const *end) noexcept
 {
     // Schedule linked tasks
     auto it = begin;
     while (true) {
         // Try to join linked task
-        if (it != end && (*it)->tryJoin()) [[likely]] {
+        if (it != end && TryJoinTask(**it)) [[likely]] {
             ++it;
             continue;
         // We either reached the end of the list or an unjoinable task
         } else [[unlikely]] {
-            scheduleWorkerTasks(cache, begin, it);
+            scheduleWorkerTasks(cache, priority, begin, it);
             if (it == end) [[likely]]
                 break;
             begin = ++it;
@@ -238,44 +609,78 @@ void Flow::Scheduler::scheduleWorkerLinkedTasks(WorkerCache &cache, Task * const
     }
 }
 
+bool Flow::Scheduler::popWorkerTask(WorkerCache &cache) noexcept
+{
+    for (std::size_t priority = 0; priority != TaskPriorityCount; ++priority) {
+        // Check size before popping as an empty worker queue pop requires a full fence
+        if (auto &queue = cache.queues[priority]; queue.size() && queue.pop(cache.task))
+            return true;
+        if (_taskQueues[priority].pop(cache.task))
+            return true;
+    }
+    return false;
+}
+
 bool Flow::Scheduler::waitWorkerTask(WorkerCache &cache) noexcept
 {
-    const auto onTaskFound = [this] {
+    const auto trace = traceBuffer(cache);
+    const auto traceBegin = trace ? GetTraceTimestamp() : 0;
+    const auto traceSteal = [&cache, trace, traceBegin] {
+        trace->push(TraceEvent { .begin = traceBegin, .end = GetTraceTimestamp(), .object = cache.task, .type = TraceEventType::Steal });
+    };
+    const auto onTaskFound = [this, &cache, trace, &traceSteal] {
+        // Update the idle estimate of the worker with the time it spent without task
+        const auto idleTime = GetTimerTimestamp() - cache.idleBegin;
+        cache.idleEstimate += (idleTime - cache.idleEstimate) / IdleEstimateWeight;
+        cache.idleBegin = 0;
+        if (trace) [[unlikely]]
+            traceSteal();
         if (_stealWorkerCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
             notifyWorker();
         return true;
     };
 
-    while (true) {
-        // Set this worker in steal mode
-        _stealWorkerCount.fetch_add(1, std::memory_order_acq_rel);
+    // Spin twice the usual idle duration of the worker, unless it is used to long idle phases
+    const auto stealBegin = GetTimerTimestamp();
+    if (!cache.idleBegin)
+        cache.idleBegin = stealBegin;
+    const auto spinTime = cache.idleEstimate > MaxSpinTime ? MinSpinTime : std::clamp(cache.idleEstimate * 2, MinSpinTime, MaxSpinTime);
+    const auto spinEnd = stealBegin + spinTime;
+    std::uint32_t backoff { 1u };
 
-        while (true) {
-            // Try to steal a task
-            if (stealWorkerTask(cache))
-                return onTaskFound();
+    // Set this worker in steal mode
+    _stealWorkerCount.fetch_add(1, std::memory_order_acq_rel);
+    while (_running.load(std::memory_order_relaxed)) {
+        // Try to steal a task
+        if (stealWorkerTask(cache))
+            return onTaskFound();
 
-            // Try to steal a task from scheduler queue
-            if (_taskQueue.size()) {
-                // We know that _taskQueue can still be inserting so we try again if pop fails
-                if (_taskQueue.pop(cache.task))
-                    return onTaskFound();
-            // If the taskqueue size is 0 we stop only if we don't have pending graphs
-            } else if (cache.pendingGraphs.empty())
-                break;
+        // Try to steal the most urgent task from scheduler queues
+        for (auto &queue : _taskQueues) {
+            if (queue.size() && queue.pop(cache.task))
+                return onTaskFound();
         }
 
-        // Leave steal mode, if there are no other thief but still active workers, prevent sleeping
-        if (_stealWorkerCount.fetch_sub(1, std::memory_order_acq_rel) == 1
-                && _activeWorkerCount.load(std::memory_order_acquire) > 0)
-            continue;
-        else
+        // Stop spinning once the spin time is over
+        if (GetTimerTimestamp() >= spinEnd)
             break;
+
+        // Exponential backoff between steal rounds to limit contention on victims
+        for (std::uint32_t i = 0; i != backoff; ++i)
+            Core::CpuRelax();
+        backoff = std::min(backoff * 2, MaxSpinBackoff);
     }
+    _stealWorkerCount.fetch_sub(1, std::memory_order_acq_rel);
 
-    // If scheduler is still running, start sleeping
+    if (trace) [[unlikely]]
+        traceSteal();
+
+    // If scheduler is still running, start parking
     if (_running.load(std::memory_order_relaxed)) [[likely]] {
-        sleepWorker();
+        const auto parkBegin = trace ? GetTraceTimestamp() : 0;
+        parkWorker(cache);
+        if (trace) [[unlikely]]
+            trace->push(TraceEvent { .begin = parkBegin, .end = GetTraceTimestamp(), .type = TraceEventType::Sleep });
         return _running.load(std::memory_order_relaxed);
     } else
         return false;
@@ -283,43 +688,107 @@ bool Flow::Scheduler::waitWorkerTask(WorkerCache &cache) noexcept
 
 bool Flow::Scheduler::stealWorkerTask(WorkerCache &cache) noexcept
 {
-    const auto workerCount = _workers.size();
-    const auto stealBound = StealBoundRatio * (workerCount + 1);
+    const auto workerCount = static_cast<std::uint32_t>(this->workerCount());
+    const auto victims = &_victims[cache.index * workerCount];
+    auto &locality = _localities[cache.index];
+
+    // Start with the closest non-empty locality
+    std::size_t localityIndex { 0u };
+    while (!locality.victimEnds[localityIndex])
+        ++localityIndex;
 
     std::size_t stealFailCount { 0u };
-    std::size_t yieldCount { 0u };
 
-    while (_running.load(std::memory_order_relaxed)) {
-        // Observe pending graphs if any, return if one completed
-        if (!cache.pendingGraphs.empty() && observeWorkerPendingGraphs(cache)) [[unlikely]]
-            return true;
-        // Generate a random index [0, workerCount[
-        const auto targetIndex = Core::Random::Generate32(workerCount);
-        // If the index is 'this' worker index, try to pop from scheduler queue
+    while (true) {
+        // Generate a random victim index among current locality and closer ones
+        const auto victimEnd = locality.victimEnds[localityIndex];
+        const auto victimIndex = Core::Random::Generate32(victimEnd);
+        const auto targetIndex = victims[victimIndex];
+        // If the index is 'this' worker index, try to pop from own queues then from scheduler queues
         if (targetIndex == cache.index) {
-            if (_workers[targetIndex].pop(cache.task))
-                break;
-        // Else try to steal from target worker
-        } else {
-            if (_taskQueue.pop(cache.task))
-                break;
+            if (popWorkerTask(cache))
+                return true;
+        // Else try to steal the oldest and most urgent task of target worker
+        } else if (StealWorkerQueues(&_workers[static_cast<std::uint32_t>(targetIndex * TaskPriorityCount)], cache.task)) {
+            // Record the locality of the victim
+            std::size_t stealLocality { 0u };
+            while (victimIndex >= locality.victimEnds[stealLocality])
+                ++stealLocality;
+            auto &steals = locality.steals[stealLocality];
+            steals.store(steals.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return true;
         }
-        // Ensure we don't steal forever
-        if (++stealFailCount >= stealBound) {
-            std::this_thread::yield();
-            if (++yieldCount == YieldBound)
-                break;
+        // Widen the victim range to the next locality once the current one is bounded, or stop after the farthest one
+        if (++stealFailCount >= StealBoundRatio * (victimEnd + 1)) {
+            if (victimEnd == locality.victimEnds.back())
+                return false;
+            while (locality.victimEnds[localityIndex] == victimEnd)
+                ++localityIndex;
+            stealFailCount = 0;
         }
     }
-    return cache.task != nullptr;
 }
 
-void Flow::Scheduler::sleepWorker(void) noexcept
+void Flow::Scheduler::parkWorker(WorkerCache &cache) noexcept
 {
-    _notifier.acquire();
+    auto &signal = _parkers[cache.index].signal;
+    auto &parked = _parkedWorkers[cache.index / 64];
+    const auto bit = 1ull << (cache.index % 64);
+
+    // Publish the worker as parked, the fence pairs with the one of 'notifyWorker':
+    // either the notifier sees this worker parked or this worker sees the scheduled task
+    signal.store(0, std::memory_order_relaxed);
+    parked.fetch_or(bit, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (hasPendingTask() || !_running.load(std::memory_order_relaxed)) {
+        // If a notifier already picked this worker, its wake signal is ignored by the next park
+        parked.fetch_and(~bit, std::memory_order_relaxed);
+        return;
+    }
+    while (!signal.load(std::memory_order_acquire))
+        signal.wait(0, std::memory_order_acquire);
+}
+
+bool Flow::Scheduler::hasPendingTask(void) const noexcept
+{
+    for (const auto &queue : _taskQueues) {
+        if (queue.size())
+            return true;
+    }
+    for (const auto &queue : _workers) {
+        if (queue.size())
+            return true;
+    }
+    return false;
 }
 
 void Flow::Scheduler::notifyWorker(void) noexcept
 {
-    _notifier.release();
-}
\ No newline at end of file
+    // Pairs with the fence of 'parkWorker', scheduled tasks must be visible before checking parked workers
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const auto cache = currentWorkerCache();
+    const auto first = cache ? (cache->index + 1) % static_cast<std::uint32_t>(workerCount()) : 0u;
+    const auto wordCount = _parkedWorkers.size();
+    for (std::uint32_t i = 0; i != wordCount; ++i) {
+        const auto wordIndex = (first / 64 + i) % wordCount;
+        auto &parked = _parkedWorkers[wordIndex];
+        auto mask = parked.load(std::memory_order_relaxed);
+        while (mask) {
+            // Prefer the closest parked worker following the notifier
+            const auto following = i ? mask : mask & (~0ull << (first % 64));
+            const auto bit = std::countr_zero(following ? following : mask);
+            if (parked.compare_exchange_weak(mask, mask & ~(1ull << bit), std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                wakeWorker(static_cast<std::uint32_t>(wordIndex * 64 + static_cast<std::uint32_t>(bit)));
+                return;
+            }
+        }
+    }
+}
+
+void Flow::Scheduler::wakeWorker(const std::uint32_t workerIndex) noexcept
+{
+    auto &signal = _parkers[workerIndex].signal;
+    signal.store(1, std::memory_order_release);
+    signal.notify_one();
+}
@@ -5,22 +5,25 @@
 
 #pragma once
 
-#include <semaphore>
 #include <future>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <Kube/Core/SmallVector.hpp>
 #include <Kube/Core/MPMCQueue.hpp>
-#include <Kube/Core/SPMCQueue.hpp>
+#include <Kube/Core/WaitQueue.hpp>
+#include <Kube/Core/WorkStealingDeque.hpp>
 #include <Kube/Core/HeapArray.hpp>
+#include <Kube/Core/UniquePtr.hpp>
+#include <Kube/Core/Vector.hpp>
 
-#include "Base.hpp"
+#include "Task.hpp"
+#include "Trace.hpp"
 
 namespace kF::Flow
 {
     class Scheduler;
-    class Task;
-    class Graph;
 }
 
 class alignas_double_cacheline kF::Flow::Scheduler
@@ -36,61 +39,180 @@ public:
     static constexpr std::size_t DefaultTaskQueueSize { 512ul };
 
 
-    /** @brief Ratio required to compute the steal bound
-     *  StealBound = StealBoundRatio * (WorkerCount + 1) */
+    /** @brief Ratio required to compute the steal bound of a locality
+     *  StealBound = StealBoundRatio * (LocalityVictimCount + 1) */
     static constexpr std::size_t StealBoundRatio = 2;
 
-    /** @brief Maximum number of yields before sleeping */
-    static constexpr std::size_t YieldBound = 100;
+    /** @brief Minimum spin duration in nanoseconds of an idle worker before parking */
+    static constexpr std::int64_t MinSpinTime = 5'000;
 
+    /** @brief Maximum spin duration in nanoseconds of an idle worker before parking
+     *  Workers spin twice their observed idle duration when it is below this bound, else only 'MinSpinTime' */
+    static constexpr std::int64_t MaxSpinTime = 200'000;
 
-    /** @brief Worker queue */
-    using WorkerQueue = Core::SPMCQueue<Task *, FlowAllocator>;
+    /** @brief Maximum number of CPU relax between two steal rounds (the backoff doubles after each failed round) */
+    static constexpr std::uint32_t MaxSpinBackoff = 64;
 
-    /** @brief Pending uncompleted graph */
-    struct PendingGraph
+    /** @brief Weight of the last idle duration in the idle estimate of a worker (1 / IdleEstimateWeight) */
+    static constexpr std::int64_t IdleEstimateWeight = 8;
+
+    /** @brief Default number of trace events kept per worker */
+    static constexpr std::size_t DefaultTraceCapacity = 16384;
+
+
+    /** @brief Placement of workers over CPUs */
+    enum class WorkerPlacement : std::uint8_t
     {
-        Task *task {};
-        Graph *graph {};
+        Unpinned, // Workers are free to migrate, victims are stolen uniformly
+        Pinned // Each worker is pinned to a CPU, victims sharing the same cache or node are stolen first
     };
 
+    /** @brief Locality of a steal victim, from the closest to the farthest */
+    enum class StealLocality : std::uint8_t
+    {
+        SameCache,
+        SameNode,
+        Remote
+    };
+
+    /** @brief Number of steal localities */
+    static constexpr std::size_t StealLocalityCount = static_cast<std::size_t>(StealLocality::Remote) + 1;
+
+    /** @brief Number of successful steals per locality */
+    using StealStats = std::array<std::size_t, StealLocalityCount>;
+
+
+    /** @brief Global task queue, workers can wait on it */
+    using TaskQueue = Core::WaitQueue<Core::MPMCQueue<Task *, FlowAllocator>>;
+
+    /** @brief Worker queue, popped LIFO by its worker and stolen FIFO by others */
+    using WorkerQueue = Core::WorkStealingDeque<Task *, FlowAllocator>;
+
     /** @brief Worker cache, only accessible from one worker */
     struct alignas_double_cacheline WorkerCache
     {
         alignas(8) std::uint32_t index {};
-        WorkerQueue &queue;
+        WorkerQueue *queues {}; // One queue per priority
         Task *task {};
-        Core::SmallVector<PendingGraph, 5, FlowAllocator> pendingGraphs {};
+        std::int64_t idleBegin {}; // Timestamp at which the worker ran out of tasks, 0 while busy
+        std::int64_t idleEstimate {}; // Moving average of the worker idle durations
+
+        /** @brief Get worker queue of a priority */
+        [[nodiscard]] inline WorkerQueue &queue(const TaskPriority priority) noexcept
+            { return queues[static_cast<std::size_t>(priority)]; }
     };
     static_assert_fit_double_cacheline(WorkerCache);
 
+    /** @brief Worker locality, victims of a worker are sorted by locality */
+    struct alignas_cacheline WorkerLocality
+    {
+        std::uint32_t cpu {}; // CPU index of a pinned worker
+        std::array<std::uint32_t, StealLocalityCount> victimEnds {}; // End of each locality in the worker victim list
+        std::array<std::atomic_size_t, StealLocalityCount> steals {}; // Successful steals per locality (only written by its worker)
+    };
+    static_assert_fit_cacheline(WorkerLocality);
+
+    /** @brief Parking slot of a worker, a parked worker waits on its own signal so it can be woken individually */
+    struct alignas_cacheline WorkerParker
+    {
+        std::atomic_uint32_t signal {}; // Set to 1 to wake up the parked worker
+    };
+    static_assert_fit_cacheline(WorkerParker);
+
+    /** @brief Timer of a delayed task */
+    struct Timer
+    {
+        std::int64_t timestamp {};
+        Task *task {};
+    };
+
+    /** @brief Delayed tasks, processed by a dedicated thread started on first use */
+    struct TimerQueue
+    {
+        std::mutex mutex {};
+        std::condition_variable condition {};
+        Core::Vector<Timer, FlowAllocator> timers {}; // Min heap of timers
+        bool running { true };
+        std::thread thread {};
+    };
+
 
     /** @brief Destroy and join all workers */
     ~Scheduler(void) noexcept;
 
-    /** @brief Constructor setup scheduler and its workers */
-    Scheduler(const std::size_t workerCount = AutoWorkerCount, const std::size_t taskQueueSize = DefaultTaskQueueSize) noexcept;
+    /** @brief Constructor setup scheduler and its workers
+     *  @note Pinned workers are spread over CPUs sorted by node and cache group, so that neighbour workers share caches */
+    Scheduler(const std::size_t workerCount = AutoWorkerCount, const std::size_t taskQueueSize = DefaultTaskQueueSize,
+            const WorkerPlacement placement = WorkerPlacement::Unpinned) noexcept;
 
 
     /** @brief Get worker counter */
-    [[nodiscard]] inline std::size_t workerCount(void) const noexcept { return static_cast<std::size_t>(_workers.size()); }
+    [[nodiscard]] inline std::size_t workerCount(void) const noexcept { return static_cast<std::size_t>(_threads.size()); }
+
+    /** @brief Get the CPU index a worker is pinned to (only meaningful with pinned placement) */
+    [[nodiscard]] inline std::uint32_t workerCpu(const std::size_t workerIndex) const noexcept
+        { return _localities[static_cast<std::uint32_t>(workerIndex)].cpu; }
+
+    /** @brief Get the number of successful steals per locality since construction
+     *  @note Unpinned workers have no known locality, all their steals are reported as remote */
+    [[nodiscard]] StealStats stealStats(void) const noexcept;
+
+
+    /** @brief Check if workers are recording trace events */
+    [[nodiscard]] inline bool tracing(void) const noexcept { return _activeTraceBuffers.load(std::memory_order_relaxed); }
+
+    /** @brief Start recording trace events into a ring buffer per worker (task executions, graph executions, steals and sleeps)
+     *  Buffers are allocated by the first call and kept until destruction, so 'capacity' is ignored by later calls
+     *  @note This function must not be called concurrently with itself */
+    void startTracing(const std::size_t capacity = DefaultTraceCapacity) noexcept;
+
+    /** @brief Stop recording trace events, recorded events are kept */
+    inline void stopTracing(void) noexcept { _activeTraceBuffers.store(nullptr, std::memory_order_release); }
+
+    /** @brief Append a snapshot of the trace events recorded by a worker into 'events' (can be called while workers are running) */
+    void collectTrace(const std::size_t workerIndex, TraceEventList &events) noexcept;
+
+    /** @brief Export a snapshot of the trace events of all workers as Chrome trace JSON (chrome://tracing, Perfetto)
+     *  Can be called while workers are running, each worker is exported as a thread */
+    void exportChromeTrace(std::ostream &stream) noexcept;
 
 
     /** @brief Schedule execution of a graph */
     void schedule(Graph &graph) noexcept;
 
-    /** @brief Schedule execution of a task
+    /** @brief Wait until graph execution is over
+     *  When called from a worker of this scheduler, the worker executes other tasks meanwhile instead of blocking
+     *  Else the calling thread spins until the graph is over */
+    void wait(Graph &graph) noexcept;
+
+    /** @brief Schedule execution of a task, using the priority of its parent graph if any
      *  @note The task must be valid the during whole duration of it processing */
     void schedule(Task &task) noexcept;
 
+    /** @brief Schedule execution of a task after at least 'delayNs' nanoseconds
+     *  @note The task must be valid the during whole duration of it processing */
+    void scheduleAfter(Task &task, const std::int64_t delayNs) noexcept;
+
+
+public: // Unsafe public functions reserved for coroutines
+    /** @brief Schedule a graph awaited by a coroutine task, the coroutine task is scheduled again once the graph is over
+     *  @return False if the graph is empty (the coroutine task is not scheduled) */
+    [[nodiscard]] bool scheduleAwait(Graph &graph, Task &coroutineTask) noexcept;
+
+
+public: // Unsafe public functions reserved for task contexts
+    /** @brief Spawn a task on behalf of a running context task into the local queue of its worker
+     *  The spawn group of the owner is allocated on first spawn */
+    void spawnWorkerTask(WorkerCache &cache, Task &owner, TaskGroup *&group, Task &task) noexcept;
+
+    /** @brief Execute a single available task from worker perspective, or relax the CPU if there is none */
+    void helpWorker(WorkerCache &cache) noexcept;
+
 
 private:
     /** @brief Run worker in blocking mode (must be called inside a worker thread) */
     void runWorker(const std::uint32_t workerIndex) noexcept;
 
-    /** @brief Observe all pending graphs of a worker */
-    bool observeWorkerPendingGraphs(WorkerCache &cache) noexcept;
-
     /** @brief Execute worker queue */
     void executeWorkerQueue(WorkerCache &cache) noexcept;
 
@@ -98,51 +220,104 @@ private:
     /** @brief Execute a task and set next one if any */
     void executeWorkerTask(WorkerCache &cache) noexcept;
 
+    /** @brief Start or resume the coroutine of a task
+     *  @return True if the coroutine is over, else it is suspended and its task will be scheduled again */
+    [[nodiscard]] bool resumeWorkerCoroutine(Task &task) noexcept;
+
+    /** @brief Complete an executed task: join its parent graph and schedule its linked tasks
+     *  @param switchIndex The linked task selected by a switch task or SIZE_MAX to schedule all of them */
+    void completeWorkerTask(WorkerCache &cache, Task &task, const std::size_t switchIndex) noexcept;
+
+    /** @brief Join tasks of a graph, completing its continuation task if the graph is over */
+    void joinWorkerGraph(WorkerCache &cache, Graph &graph, const std::size_t taskCount) noexcept;
+
     /** @brief Join a task ignored from a conditional flow */
     void joinWorkerConditionalTask(WorkerCache &cache, Task * const task, std::size_t &joinCount) noexcept;
 
-    /** @brief Schedule a range of tasks from worker perspective */
-    void scheduleWorkerTasks(WorkerCache &cache, Task * const *begin, Task * const *end) noexcept;
+    /** @brief Schedule a range of tasks sharing the same priority from worker perspective */
+    void scheduleWorkerTasks(WorkerCache &cache, const TaskPriority priority, Task * const *begin, Task * const *end) noexcept;
+
+    /** @brief Schedule a range of linked tasks sharing the same priority from worker perspective */
+    void scheduleWorkerLinkedTasks(WorkerCache &cache, const TaskPriority priority, Task * const *begin, Task * const *end) noexcept;
 
-    /** @brief Schedule a range of linked tasks from worker perspective */
-    void scheduleWorkerLinkedTasks(WorkerCache &cache, Task * const *begin, Task * const *end) noexcept;
+
+    /** @brief Pick the most urgent task available to a worker
+     *  For each priority, the worker queue is checked before the global queue,
+     *  so that a higher priority task always preempts lower priority local work */
+    [[nodiscard]] bool popWorkerTask(WorkerCache &cache) noexcept;
 
 
     /** @brief Make worker wait until a task is ready */
     [[nodiscard]] bool waitWorkerTask(WorkerCache &cache) noexcept;
 
 
+    /** @brief Setup worker localities and victim lists */
+    void setupWorkerLocalities(const WorkerPlacement placement) noexcept;
+
+    /** @brief Run the timer thread until destruction */
+    void runTimers(void) noexcept;
+
+    /** @brief Get the trace buffer of a worker if tracing, else nullptr */
+    [[nodiscard]] inline TraceBuffer *traceBuffer(const WorkerCache &cache) noexcept
+    {
+        const auto buffers = _activeTraceBuffers.load(std::memory_order_acquire);
+        return buffers ? buffers + cache.index : nullptr;
+    }
+
+    /** @brief Get the cache of the calling worker if it belongs to this scheduler, else nullptr */
+    [[nodiscard]] WorkerCache *currentWorkerCache(void) const noexcept;
+
     /** @brief Try to steal a task for worker to continue executing */
     [[nodiscard]] bool stealWorkerTask(WorkerCache &cache) noexcept;
 
 
-    /** @brief Put worker onto sleep until notified (must be called from a worker thread) */
-    void sleepWorker(void) noexcept;
+    /** @brief Park worker until notified (must be called from a worker thread)
+     *  Returns immediately if a task is pending once the worker is visible as parked */
+    void parkWorker(WorkerCache &cache) noexcept;
+
+    /** @brief Check if any task queue is not empty */
+    [[nodiscard]] bool hasPendingTask(void) const noexcept;
 
 
-    /** @brief Wake up a single worker (can be called on any thread) */
+    /** @brief Wake up a single parked worker if any (can be called on any thread)
+     *  Called from a worker, the closest parked worker following it is preferred since neighbour workers share caches */
     void notifyWorker(void) noexcept;
 
+    /** @brief Wake up a specific worker */
+    void wakeWorker(const std::uint32_t workerIndex) noexcept;
+
+
+    /** @brief Get global task queue of a priority */
+    [[nodiscard]] inline TaskQueue &taskQueue(const TaskPriority priority) noexcept
+        { return _taskQueues[static_cast<std::size_t>(priority)]; }
+
 
-    // Cacheline 0 -> 3
-    Core::MPMCQueue<Task *, FlowAllocator> _taskQueue;
+    // Cacheline 0 -> 17
+    std::array<TaskQueue, TaskPriorityCount> _taskQueues; // One queue per priority
 
-    // Cacheline 4 & 5
-    Core::HeapArray<WorkerQueue, FlowAllocator> _workers {}; // Worker array
+    // Cacheline 18 & 19
+    Core::HeapArray<WorkerQueue, FlowAllocator> _workers {}; // Worker queues array (TaskPriorityCount queues per worker)
+    Core::HeapArray<WorkerLocality, FlowAllocator> _localities {}; // Worker localities
+    Core::HeapArray<std::uint32_t, FlowAllocator> _victims {}; // Victim lists sorted by locality ('workerCount' victims per worker)
     Core::HeapArray<std::thread> _threads {}; // We don't use FlowAllocator because threads are permanently unaccessed until destruction
+    Core::UniquePtr<TimerQueue, FlowAllocator> _timers {}; // Delayed tasks, allocated on first use
+    std::once_flag _timersOnce {};
+    Core::HeapArray<TraceBuffer, FlowAllocator> _traceBuffers {}; // Trace buffers (one per worker), allocated on first use
+    std::atomic<TraceBuffer *> _activeTraceBuffers {}; // Trace buffers while tracing, else nullptr
 
-    // Cacheline 6 & 7
+    // Cacheline 20 & 21
     alignas_double_cacheline std::atomic_bool _running { true };
 
-    // Cacheline 8 & 9
-    alignas_double_cacheline std::counting_semaphore<> _notifier { 0 };
+    // Cacheline 22 & 23
+    alignas_double_cacheline Core::HeapArray<std::atomic_uint64_t, FlowAllocator> _parkedWorkers {}; // Bitset of parked workers
+    Core::HeapArray<WorkerParker, FlowAllocator> _parkers {}; // Parking slot of each worker
 
-    // Cacheline 10 & 11
+    // Cacheline 24 & 25
     alignas_double_cacheline std::atomic_size_t _activeWorkerCount { 0 };
 
-    // Cacheline 12 & 13
+    // Cacheline 26 & 27
     alignas_double_cacheline std::atomic_size_t _stealWorkerCount { 0 };
 };
 
 static_assert_alignof_double_cacheline(kF::Flow::Scheduler);
-static_assert_sizeof(kF::Flow::Scheduler, kF::Core::CacheLineDoubleSize * 7);
\ No newline at end of file
+static_assert_sizeof(kF::Flow::Scheduler, kF::Core::CacheLineDoubleSize * 14);
\ No newline at end of file
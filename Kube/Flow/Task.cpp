@@ -5,7 +5,7 @@
 
 #include <Kube/Core/Abort.hpp>
 
-#include "Task.hpp"
+#include "Graph.hpp"
 
 using namespace kF;
 
@@ -15,6 +15,7 @@ Flow::Task::~Task(void) noexcept
 
 Flow::Task &Flow::Task::before(Task &other) noexcept
 {
+    invalidateParentGraph();
     _linkedTo.push(&other);
     other._linkedFrom.push(this);
     return *this;
@@ -22,6 +23,7 @@ Flow::Task &Flow::Task::before(Task &other) noexcept
 
 Flow::Task &Flow::Task::after(Task &other) noexcept
 {
+    invalidateParentGraph();
     _linkedFrom.push(&other);
     other._linkedTo.push(this);
     return *this;
@@ -29,6 +31,7 @@ Flow::Task &Flow::Task::after(Task &other) noexcept
 
 void Flow::Task::reset(void) noexcept
 {
+    invalidateParentGraph();
     for (Task * const link : _linkedFrom) {
         const auto it = link->_linkedTo.find(this);
         kFEnsure(it != link->_linkedTo.end(), "Flow::Task::reset: Self not found inside linked task");
@@ -39,4 +42,10 @@ void Flow::Task::reset(void) noexcept
         kFEnsure(it != link->_linkedFrom.end(), "Flow::Task::reset: Self not found inside linked task");
         link->_linkedFrom.erase(it);
     }
-}
\ No newline at end of file
+}
+
+void Flow::Task::invalidateParentGraph(void) noexcept
+{
+    if (_parent)
+        _parent->invalidateScheduleCache();
+}
@@ -9,12 +9,14 @@
 #include <Kube/Core/Functor.hpp>
 #include <Kube/Core/UniquePtr.hpp>
 
-#include "Base.hpp"
+#include "CoTask.hpp"
 
 namespace kF::Flow
 {
     class Task;
     class Graph;
+    class TaskContext;
+    struct TaskGroup;
 
     /** @brief Unique pointer over Task */
     using TaskPtr = Core::UniquePtr<Task, FlowAllocator>;
@@ -24,6 +26,17 @@ namespace kF::Flow
 
     /** @brief List of task references */
     using TaskRefList = Core::Vector<Task *, FlowAllocator>;
+
+    /** @brief Scheduling priority of tasks, from the most to the least urgent */
+    enum class TaskPriority : std::uint8_t
+    {
+        Critical,
+        Normal,
+        Background
+    };
+
+    /** @brief Number of task priorities */
+    constexpr std::size_t TaskPriorityCount = static_cast<std::size_t>(TaskPriority::Background) + 1;
 }
 
 /** @brief Task in a graph */
@@ -40,16 +53,31 @@ public:
      *  @note Index TaskCount (out of the task indexing range) means no task is selected by the switch (like a 'default: break') */
     using SwitchWork = Core::Functor<std::size_t(void), FlowAllocator, Core::CacheLineEighthSize * 7>;
 
+    /** @brief Context work, can spawn child tasks from the context of the running task (see TaskContext) */
+    using ContextWork = Core::Functor<void(TaskContext &), FlowAllocator, Core::CacheLineEighthSize * 7>;
+
     /** @brief Graph work */
     using GraphWork = Graph *;
 
+    /** @brief Coroutine work, the factory is called each time the task starts
+     *  @note The coroutine frame may reference the factory instance, which lives as long as the task */
+    struct CoroutineWork
+    {
+        using Factory = Core::Functor<CoTask(void), FlowAllocator, Core::CacheLineEighthSize * 6>;
+
+        Factory factory {};
+        CoTask::Handle handle {}; // Coroutine being executed
+    };
+
     /** @brief Types of work */
     enum class WorkType : std::uint32_t
     {
         None,
         Static,
         Switch,
-        Graph
+        Context,
+        Graph,
+        Coroutine
     };
 
     /** @brief Work */
@@ -60,7 +88,9 @@ public:
             NoneWork noneWork {};
             StaticWork staticWork;
             SwitchWork switchWork;
+            ContextWork contextWork;
             GraphWork graphWork;
+            CoroutineWork coroutineWork;
         };
 
         /** @brief Destructor */
@@ -95,6 +125,14 @@ public:
     [[nodiscard]] inline Graph *parent(void) const noexcept { return _parent; }
 
 
+    /** @brief Get the name of the task used by traces, null if not set */
+    [[nodiscard]] inline const char *name(void) const noexcept { return _name; }
+
+    /** @brief Set the name of the task used by traces
+     *  @note The name must be null-terminated and outlive the task (ex: string literal) */
+    inline Task &setName(const char * const name) noexcept { _name = name; return *this; }
+
+
     /** @brief Get opaque work functor instance */
     [[nodiscard]] inline Work &work(void) noexcept { return _work; }
 
@@ -102,6 +140,10 @@ public:
     [[nodiscard]] inline const Work &work(void) const noexcept { return _work; }
 
 
+    /** @brief Get the group this task was spawned into, null if the task was not spawned by a context task */
+    [[nodiscard]] inline TaskGroup *spawnGroup(void) const noexcept { return _spawnGroup; }
+
+
     /** @brief Get tasks linked before this node */
     [[nodiscard]] inline const TaskRefList &linkedFrom(void) const noexcept { return _linkedFrom; }
 
@@ -129,16 +171,31 @@ public: // Unsafe public functions reserved for workers
     /** @brief Reset the join count of the task */
     inline void prepareToSchedule(void) noexcept { _joinCount.store(0, std::memory_order_relaxed); }
 
+    /** @brief Get the index of the task inside the compiled data of its parent graph */
+    [[nodiscard]] inline std::uint32_t index(void) const noexcept { return _index; }
+
+    /** @brief Set the group this task is spawned into */
+    inline void setSpawnGroup(TaskGroup * const group) noexcept { _spawnGroup = group; }
+
 
 private:
+    friend Graph;
+
     // Cacheline 0
     Work _work;
 
     // Cacheline 1
     Graph *_parent {};
-    std::atomic_size_t _joinCount {};
+    std::atomic_uint32_t _joinCount {};
+    std::uint32_t _index {};
     TaskRefList _linkedFrom {};
     TaskRefList _linkedTo {};
+    const char *_name {};
+    TaskGroup *_spawnGroup {};
+
+
+    /** @brief Invalidate the compiled links of the parent graph */
+    void invalidateParentGraph(void) noexcept;
 };
 
 static_assert_fit_double_cacheline(kF::Flow::Task);
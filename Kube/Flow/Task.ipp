@@ -14,9 +14,17 @@ inline kF::Flow::Task::Work::~Work(void) noexcept
     case WorkType::Switch:
         switchWork.~SwitchWork();
         break;
+    case WorkType::Context:
+        contextWork.~ContextWork();
+        break;
     case WorkType::Graph:
         graphWork.~GraphWork();
         break;
+    case WorkType::Coroutine:
+        if (coroutineWork.handle)
+            coroutineWork.handle.destroy();
+        coroutineWork.~CoroutineWork();
+        break;
     default:
         break;
     }
@@ -28,6 +36,14 @@ inline kF::Flow::Task::Work::Work(Type &&value) noexcept
     if constexpr (std::is_constructible_v<GraphWork, Type>) {
         type = WorkType::Graph;
         new (&graphWork) GraphWork(std::forward<Type>(value));
+    } else if constexpr (std::is_invocable_v<Type &, TaskContext &>) {
+        // Core invocable requirements ignore extra arguments, so a context work is detected using its exact signature
+        static_assert(std::is_void_v<std::invoke_result_t<Type &, TaskContext &>>, "Flow::Task::Work: Context work must return void");
+        type = WorkType::Context;
+        new (&contextWork) ContextWork(std::forward<Type>(value));
+    } else if constexpr (Core::InvocableRequirements<Type, CoTask>) {
+        type = WorkType::Coroutine;
+        new (&coroutineWork) CoroutineWork { .factory = CoroutineWork::Factory(std::forward<Type>(value)) };
     } else if constexpr (Core::InvocableRequirements<Type, std::size_t>) {
         type = WorkType::Switch;
         new (&switchWork) SwitchWork(std::forward<Type>(value));
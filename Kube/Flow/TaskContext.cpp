@@ -0,0 +1,30 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flow task context
+ */
+
+#include "TaskContext.hpp"
+
+using namespace kF;
+
+std::uint32_t Flow::TaskContext::pendingCount(void) const noexcept
+{
+    return _group ? _group->pendingCount.load(std::memory_order_acquire) - 1 : 0u;
+}
+
+void Flow::TaskContext::wait(void) noexcept
+{
+    while (pendingCount())
+        _scheduler->helpWorker(*_cache);
+}
+
+bool Flow::TaskContext::release(void) noexcept
+{
+    if (!_group) [[likely]]
+        return true;
+    else if (_group->pendingCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return false;
+    FlowAllocator::Deallocate(_group, sizeof(TaskGroup), alignof(TaskGroup));
+    _group = nullptr;
+    return true;
+}
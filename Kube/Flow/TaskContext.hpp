@@ -0,0 +1,82 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flow task context
+ */
+
+#pragma once
+
+#include "Scheduler.hpp"
+
+namespace kF::Flow
+{
+    class TaskContext;
+    struct TaskGroup;
+}
+
+/** @brief Group of the tasks spawned by a single execution of a context task */
+struct kF::Flow::TaskGroup
+{
+    Task *owner {}; // Task that spawned the group, completed by the last spawned task
+    std::atomic_uint32_t pendingCount { 1u }; // Spawned tasks not over yet (+1 while the owner work is running)
+    TaskPriority priority { TaskPriority::Normal }; // Priority of the owner, inherited by spawned tasks
+};
+
+/** @brief Context of a running task, given to works taking a 'TaskContext &' parameter
+ *  A context task can spawn child tasks into the local queue of its worker, where idle workers can steal them
+ *  The successors of a context task only run once all its spawned tasks are over, including the ones they spawned in turn
+ *  Example:
+ *      graph.add([&](Flow::TaskContext &context) {
+ *          for (auto &node : quadtree.children(root))
+ *              context.spawn([&node](Flow::TaskContext &context) { cull(context, node); });
+ *      });
+ *  @note A context is only valid during the execution of its work */
+class kF::Flow::TaskContext
+{
+public:
+    /** @brief Destructor */
+    inline ~TaskContext(void) noexcept = default;
+
+    /** @brief Constructor */
+    inline TaskContext(Scheduler &scheduler, Scheduler::WorkerCache &cache, Task &task) noexcept
+        : _scheduler(&scheduler), _cache(&cache), _task(&task) {}
+
+    /** @brief TaskContext is not copiable */
+    TaskContext(const TaskContext &other) noexcept = delete;
+    TaskContext &operator=(const TaskContext &other) noexcept = delete;
+
+
+    /** @brief Get the scheduler executing the task */
+    [[nodiscard]] inline Scheduler &scheduler(void) const noexcept { return *_scheduler; }
+
+    /** @brief Get the running task */
+    [[nodiscard]] inline Task &task(void) const noexcept { return *_task; }
+
+
+    /** @brief Get the number of spawned tasks that are not over yet */
+    [[nodiscard]] std::uint32_t pendingCount(void) const noexcept;
+
+
+    /** @brief Spawn a child task into the local queue of the calling worker
+     *  The work can take a 'TaskContext &' parameter to spawn tasks in turn
+     *  @note Spawned tasks have no successor, a switch work must always return 0 */
+    template<typename WorkFunc>
+    void spawn(WorkFunc &&work) noexcept;
+
+    /** @brief Wait until all spawned tasks are over, the worker executes other tasks meanwhile
+     *  Tasks can be spawned again once the wait is over */
+    void wait(void) noexcept;
+
+
+public: // Unsafe public functions reserved for workers
+    /** @brief Release the group of spawned tasks once the work returned
+     *  @return True if no spawned task is running, else the task is completed by the last spawned task */
+    [[nodiscard]] bool release(void) noexcept;
+
+private:
+    Scheduler *_scheduler {};
+    Scheduler::WorkerCache *_cache {};
+    Task *_task {};
+    TaskGroup *_group {}; // Allocated on first spawn
+};
+
+#include "TaskContext.ipp"
@@ -0,0 +1,14 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flow task context
+ */
+
+#include "TaskContext.hpp"
+
+template<typename WorkFunc>
+inline void kF::Flow::TaskContext::spawn(WorkFunc &&work) noexcept
+{
+    // Spawned tasks are destroyed by the worker that completes them
+    const auto task = new (FlowAllocator::Allocate(sizeof(Task), alignof(Task))) Task(std::forward<WorkFunc>(work));
+    _scheduler->spawnWorkerTask(*_cache, *_task, _group, *task);
+}
@@ -0,0 +1,100 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of CoTask
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Flow/Scheduler.hpp>
+#include <Kube/Flow/Graph.hpp>
+
+using namespace kF;
+
+static std::size_t MaxThreads = std::max(2u, std::thread::hardware_concurrency());
+
+TEST(CoTask, AwaitGraph)
+{
+    constexpr std::size_t TaskCount = 16;
+    constexpr std::size_t RepeatCount = 10;
+
+    for (const std::size_t workerCount : { 1ul, MaxThreads }) {
+        Flow::Scheduler scheduler(workerCount);
+        Flow::Graph graph, inner, empty;
+        std::atomic_size_t counter {}, trigger {};
+        bool success { true };
+
+        for (std::size_t i = 0; i != TaskCount; ++i)
+            inner.add([&counter] { ++counter; });
+        auto &coroutine = graph.add([&]() -> Flow::CoTask {
+            const auto begin = counter.load();
+            co_await inner;
+            success &= counter == begin + TaskCount;
+            co_await empty;
+            co_await inner;
+            success &= counter == begin + TaskCount * 2;
+        });
+        // Linked tasks are scheduled once the coroutine is over
+        graph.add([&] { ++trigger; }).after(coroutine);
+
+        for (std::size_t i = 0; i != RepeatCount; ++i) {
+            scheduler.schedule(graph);
+            graph.waitSpin();
+        }
+        ASSERT_TRUE(success);
+        ASSERT_EQ(counter, TaskCount * 2 * RepeatCount);
+        ASSERT_EQ(trigger, RepeatCount);
+    }
+}
+
+TEST(CoTask, Sleep)
+{
+    constexpr std::int64_t SleepTime = 20'000'000;
+
+    // A single worker executes other tasks while the coroutine sleeps
+    Flow::Scheduler scheduler(1);
+    Flow::Graph graph;
+    std::atomic_bool executed {};
+    bool executedDuringSleep {};
+    std::int64_t elapsed {};
+
+    graph.add([&]() -> Flow::CoTask {
+        const auto begin = std::chrono::steady_clock::now();
+        co_await Flow::SleepFor(SleepTime);
+        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+        executedDuringSleep = executed;
+    });
+    graph.add([&executed] { executed = true; });
+    scheduler.schedule(graph);
+    graph.waitSleep(1'000'000);
+    ASSERT_GE(elapsed, SleepTime);
+    ASSERT_TRUE(executedDuringSleep);
+}
+
+TEST(CoTask, Event)
+{
+    Flow::Scheduler scheduler(MaxThreads);
+    Flow::Graph graph;
+    Flow::CoEvent event, setEvent;
+    std::size_t step {};
+
+    setEvent.set();
+    graph.add([&]() -> Flow::CoTask {
+        co_await setEvent;
+        step = 1;
+        co_await event;
+        step = 2;
+    });
+    scheduler.schedule(graph);
+
+    // Simulate an IO completion from another thread
+    std::thread([&event] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        event.set();
+    }).join();
+    graph.waitSpin();
+    ASSERT_TRUE(event.isSet());
+    ASSERT_EQ(step, 2);
+}
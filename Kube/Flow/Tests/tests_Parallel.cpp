@@ -0,0 +1,79 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of Parallel algorithms
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Flow/Parallel.hpp>
+
+using namespace kF;
+
+static std::size_t MaxThreads = std::max(2u, std::thread::hardware_concurrency());
+
+TEST(Parallel, For)
+{
+    constexpr std::size_t Count = 1'000'000;
+
+    Flow::Scheduler scheduler(MaxThreads);
+    std::vector<std::uint8_t> visits(Count);
+
+    for (const std::size_t grainSize : { 1ul, 1000ul, Count }) {
+        std::fill(visits.begin(), visits.end(), 0);
+        Flow::ParallelFor(scheduler, 0ul, Count, grainSize, [&visits, grainSize](const std::size_t from, const std::size_t to) {
+            ASSERT_LT(from, to);
+            ASSERT_TRUE(to - from >= grainSize || to == Count);
+            for (auto i = from; i != to; ++i)
+                ++visits[i];
+        });
+        ASSERT_EQ(std::count(visits.begin(), visits.end(), 1), Count);
+    }
+
+    // Empty range
+    Flow::ParallelFor(scheduler, 10, 10, 1, [](const int, const int) { FAIL(); });
+}
+
+TEST(Parallel, Reduce)
+{
+    constexpr std::int64_t Count = 1'000'000;
+
+    Flow::Scheduler scheduler(MaxThreads);
+    const auto sum = [](const std::int64_t lhs, const std::int64_t rhs) { return lhs + rhs; };
+    const auto map = [](const std::int64_t from, const std::int64_t to) {
+        std::int64_t value {};
+        for (auto i = from; i != to; ++i)
+            value += i;
+        return value;
+    };
+
+    ASSERT_EQ(Flow::ParallelReduce<std::int64_t>(scheduler, 0, Count, 100, std::int64_t {}, map, sum), Count * (Count - 1) / 2);
+    ASSERT_EQ(Flow::ParallelReduce<std::int64_t>(scheduler, -Count, Count, 100, std::int64_t {}, map, sum), -Count);
+    ASSERT_EQ(Flow::ParallelReduce<std::int64_t>(scheduler, 5, 5, 1, std::int64_t { 42 }, map, sum), 42);
+}
+
+TEST(Parallel, NestedInTask)
+{
+    constexpr std::size_t Count = 100'000;
+    constexpr std::size_t TaskCount = 8;
+
+    // A single worker must not deadlock when a task waits for its own parallel loop
+    for (const std::size_t workerCount : { 1ul, MaxThreads }) {
+        Flow::Scheduler scheduler(workerCount);
+        Flow::Graph graph;
+        std::atomic_size_t total {};
+
+        for (std::size_t i = 0; i != TaskCount; ++i) {
+            graph.add([&scheduler, &total] {
+                total += Flow::ParallelReduce(scheduler, 0ul, Count, 64ul, 0ul,
+                    [](const std::size_t from, const std::size_t to) { return to - from; },
+                    [](const std::size_t lhs, const std::size_t rhs) { return lhs + rhs; });
+            });
+        }
+        scheduler.schedule(graph);
+        graph.waitSpin();
+        ASSERT_EQ(total, Count * TaskCount);
+    }
+}
@@ -3,10 +3,13 @@
  * @ Description: Unit tests of Scheduler
  */
 
+#include <algorithm>
+#include <sstream>
 #include <thread>
 
 #include <gtest/gtest.h>
 
+#include <Kube/Core/CpuTopology.hpp>
 #include <Kube/Flow/Scheduler.hpp>
 #include <Kube/Flow/Graph.hpp>
 
@@ -315,3 +318,209 @@ TEST(Scheduler, GraphTask)
         }
     }
 }
+
+TEST(Scheduler, NestedGraphTask)
+{
+    for (auto i = 0ul; i != MaxThreads; ++i) {
+        Flow::Scheduler scheduler(i);
+        std::atomic<int> trigger = 0;
+
+        // Innermost graph executes 4 parallel tasks
+        Flow::Graph innerGraph;
+        for (auto k = 0; k < 4; ++k)
+            innerGraph.add([&trigger] { ++trigger; });
+
+        // Middle graph executes the inner graph then an empty graph
+        Flow::Graph emptyGraph;
+        Flow::Graph middleGraph;
+        middleGraph.add(&innerGraph).before(middleGraph.add(&emptyGraph));
+
+        // Completion of nested graphs must be propagated to the last task
+        Flow::Graph graph;
+        auto &last = graph.add([&trigger] { trigger = trigger * 10; });
+        graph.add(&middleGraph).before(last);
+
+        for (std::size_t k = 0; k < RepeatCount; ++k) {
+            trigger = 0;
+            scheduler.schedule(graph);
+            graph.waitSpin();
+            ASSERT_EQ(trigger, 40);
+        }
+    }
+}
+
+TEST(Scheduler, CompiledGraph)
+{
+    for (auto i = 0ul; i != MaxThreads; ++i) {
+        Flow::Scheduler scheduler(i);
+        Flow::Graph graph;
+        std::atomic_int order {};
+        int a {}, b {}, c {};
+
+        auto &taskA = graph.add([&] { a = ++order; });
+        auto &taskB = graph.add([&] { b = ++order; });
+        auto &taskC = graph.add([&] { c = ++order; });
+        taskB.after(taskA);
+        ASSERT_FALSE(graph.compiled());
+        for (std::size_t k = 0; k < RepeatCount; ++k) {
+            order = 0;
+            scheduler.schedule(graph);
+            graph.waitSpin();
+            ASSERT_TRUE(graph.compiled());
+            ASSERT_LT(a, b);
+        }
+
+        // Linking tasks invalidates the compiled graph
+        taskC.after(taskB);
+        ASSERT_FALSE(graph.compiled());
+        for (std::size_t k = 0; k < RepeatCount; ++k) {
+            order = 0;
+            scheduler.schedule(graph);
+            graph.waitSpin();
+            ASSERT_EQ(a, 1);
+            ASSERT_EQ(b, 2);
+            ASSERT_EQ(c, 3);
+        }
+
+        // Removing a task unlinks it, its successors become roots
+        graph.remove(taskA);
+        a = 0;
+        order = 0;
+        scheduler.schedule(graph);
+        graph.waitSpin();
+        ASSERT_EQ(a, 0);
+        ASSERT_EQ(b, 1);
+        ASSERT_EQ(c, 2);
+    }
+}
+
+TEST(Scheduler, TaskPriority)
+{
+    constexpr std::size_t TaskCount = 8;
+
+    Flow::Scheduler scheduler(1);
+    Flow::Graph blocker, background, critical, nested;
+    std::atomic_bool started {}, released {};
+    std::atomic_size_t order {};
+    std::size_t backgroundOrders[TaskCount] {}, criticalOrders[TaskCount * 2] {};
+
+    blocker.add([&started, &released] {
+        started = true;
+        while (!released)
+            std::this_thread::yield();
+    });
+    background.setPriority(Flow::TaskPriority::Background);
+    nested.setPriority(Flow::TaskPriority::Background); // Inherits critical priority from its parent graph
+    critical.setPriority(Flow::TaskPriority::Critical);
+    for (auto i = 0ul; i != TaskCount; ++i) {
+        background.add([&order, &backgroundOrders, i] { backgroundOrders[i] = order++; });
+        critical.add([&order, &criticalOrders, i] { criticalOrders[i] = order++; });
+        nested.add([&order, &criticalOrders, i] { criticalOrders[TaskCount + i] = order++; });
+    }
+    critical.add(&nested);
+
+    // Block the only worker then queue background work before critical work
+    scheduler.schedule(blocker);
+    while (!started)
+        std::this_thread::yield();
+    scheduler.schedule(background);
+    scheduler.schedule(critical);
+    released = true;
+    background.waitSleep(1'000'000);
+    critical.waitSleep(1'000'000);
+    blocker.waitSleep(1'000'000);
+
+    // Every critical task must have been executed before any background task
+    const auto lastCritical = *std::max_element(std::begin(criticalOrders), std::end(criticalOrders));
+    const auto firstBackground = *std::min_element(std::begin(backgroundOrders), std::end(backgroundOrders));
+    ASSERT_LT(lastCritical, firstBackground);
+    ASSERT_EQ(order, TaskCount * 3);
+}
+
+TEST(Scheduler, PinnedWorkers)
+{
+    constexpr std::size_t TaskCount = 256;
+
+    Flow::Scheduler scheduler(MaxThreads, Flow::Scheduler::DefaultTaskQueueSize, Flow::Scheduler::WorkerPlacement::Pinned);
+    Flow::Graph graph;
+    std::atomic_size_t trigger {};
+
+    auto &root = graph.add([] {});
+    for (auto i = 0ul; i != TaskCount; ++i)
+        graph.add([&trigger] { ++trigger; }).after(root);
+    for (auto i = 0ul; i != RepeatCount; ++i) {
+        scheduler.schedule(graph);
+        graph.waitSpin();
+    }
+    ASSERT_EQ(trigger, TaskCount * RepeatCount);
+
+    // Every worker is pinned to an available CPU
+    const auto topology = Core::CpuTopology::Discover();
+    for (auto i = 0ul; i != scheduler.workerCount(); ++i) {
+        const auto cpu = scheduler.workerCpu(i);
+        ASSERT_NE(topology.cpus().find([cpu](const auto &info) { return info.index == cpu; }), topology.cpus().end());
+    }
+}
+
+TEST(Scheduler, Tracing)
+{
+    constexpr std::size_t TaskCount = 8;
+
+    Flow::Scheduler scheduler(2);
+    Flow::Graph graph;
+    graph.setName("Frame");
+    auto &root = graph.add([] {}).setName("Root");
+    for (auto i = 0ul; i != TaskCount; ++i)
+        graph.add([] {}).setName("Child \"quoted\"").after(root);
+
+    // Nothing is recorded until tracing starts
+    scheduler.schedule(graph);
+    graph.waitSpin();
+    Flow::TraceEventList events;
+    for (auto i = 0ul; i != scheduler.workerCount(); ++i)
+        scheduler.collectTrace(i, events);
+    ASSERT_TRUE(events.empty());
+
+    scheduler.startTracing();
+    ASSERT_TRUE(scheduler.tracing());
+    for (auto i = 0ul; i != RepeatCount; ++i) {
+        scheduler.schedule(graph);
+        graph.waitSpin();
+    }
+    scheduler.stopTracing();
+    ASSERT_FALSE(scheduler.tracing());
+
+    std::size_t taskEvents {}, graphEvents {};
+    for (auto i = 0ul; i != scheduler.workerCount(); ++i)
+        scheduler.collectTrace(i, events);
+    for (const auto &event : events) {
+        ASSERT_LE(event.begin, event.end);
+        taskEvents += event.type == Flow::TraceEventType::Task;
+        graphEvents += event.type == Flow::TraceEventType::Graph && event.object == &graph;
+    }
+    ASSERT_EQ(taskEvents, (TaskCount + 1) * RepeatCount);
+    ASSERT_EQ(graphEvents, RepeatCount);
+
+    std::ostringstream stream;
+    scheduler.exportChromeTrace(stream);
+    const auto json = stream.str();
+    ASSERT_TRUE(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    ASSERT_TRUE(json.ends_with("]}"));
+    ASSERT_NE(json.find("\"name\":\"Frame\",\"cat\":\"graph\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"Root\",\"cat\":\"task\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"Child \\\"quoted\\\"\""), std::string::npos);
+}
+
+TEST(Scheduler, TraceBufferOverwrite)
+{
+    Flow::TraceBuffer buffer(5);
+    ASSERT_EQ(buffer.capacity(), 8);
+
+    for (std::int64_t i = 0; i != 20; ++i)
+        buffer.push(Flow::TraceEvent { .begin = i, .end = i });
+    Flow::TraceEventList events;
+    buffer.collect(events);
+    ASSERT_EQ(events.size(), 8);
+    for (std::int64_t i = 0; const auto &event : events)
+        ASSERT_EQ(event.begin, 12 + i++);
+}
@@ -0,0 +1,94 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of TaskContext
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Flow/Scheduler.hpp>
+#include <Kube/Flow/Graph.hpp>
+#include <Kube/Flow/TaskContext.hpp>
+
+using namespace kF;
+
+static std::size_t MaxThreads = std::max(2u, std::thread::hardware_concurrency());
+
+/** @brief Recursively compute a fibonacci number by spawning and waiting a task per branch */
+static void Fibonacci(Flow::TaskContext &context, const std::size_t n, std::size_t &result) noexcept
+{
+    if (n < 2) {
+        result = n;
+        return;
+    }
+    std::size_t lhs {}, rhs {};
+    context.spawn([n, &lhs](Flow::TaskContext &context) { Fibonacci(context, n - 1, lhs); });
+    context.spawn([n, &rhs](Flow::TaskContext &context) { Fibonacci(context, n - 2, rhs); });
+    context.wait();
+    result = lhs + rhs;
+}
+
+TEST(TaskContext, SpawnWait)
+{
+    for (const std::size_t workerCount : { 1ul, MaxThreads }) {
+        Flow::Scheduler scheduler(workerCount);
+        Flow::Graph graph;
+        std::size_t result {};
+
+        graph.add([&result](Flow::TaskContext &context) { Fibonacci(context, 20, result); });
+        scheduler.schedule(graph);
+        graph.waitSpin();
+        ASSERT_EQ(result, 6765);
+    }
+}
+
+TEST(TaskContext, SuccessorsAfterSpawnedTasks)
+{
+    constexpr std::size_t Depth = 8;
+    constexpr std::size_t RepeatCount = 10;
+
+    for (const std::size_t workerCount : { 1ul, MaxThreads }) {
+        Flow::Scheduler scheduler(workerCount);
+        Flow::Graph graph;
+        std::atomic_size_t counter {};
+        std::size_t observed {};
+
+        // Recursively spawn a binary tree without waiting, the successor must only run once every leaf is over
+        Core::Functor<void(Flow::TaskContext &, std::size_t)> split;
+        split = [&split, &counter](Flow::TaskContext &context, const std::size_t depth) {
+            if (!depth) {
+                ++counter;
+                return;
+            }
+            for (std::size_t i = 0; i != 2; ++i)
+                context.spawn([&split, depth](Flow::TaskContext &context) { split(context, depth - 1); });
+        };
+        auto &root = graph.add([&split](Flow::TaskContext &context) { split(context, Depth); });
+        graph.add([&counter, &observed] { observed = counter; }).after(root);
+
+        for (std::size_t i = 0; i != RepeatCount; ++i) {
+            counter = 0;
+            scheduler.schedule(graph);
+            graph.waitSpin();
+            ASSERT_EQ(observed, 1ul << Depth);
+            ASSERT_EQ(counter, 1ul << Depth);
+        }
+    }
+}
+
+TEST(TaskContext, NoSpawn)
+{
+    Flow::Scheduler scheduler(1);
+    Flow::Graph graph;
+    std::size_t counter {};
+
+    auto &root = graph.add([&counter](Flow::TaskContext &context) {
+        context.wait();
+        counter += context.pendingCount() + 1;
+    });
+    graph.add([&counter] { ++counter; }).after(root);
+    scheduler.schedule(graph);
+    graph.waitSpin();
+    ASSERT_EQ(counter, 2);
+}
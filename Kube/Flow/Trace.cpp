@@ -0,0 +1,124 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flow scheduler tracing
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <ostream>
+
+#include <Kube/Core/Utils.hpp>
+
+#include "Trace.hpp"
+
+using namespace kF;
+
+/** @brief Store an event field by field so that concurrent readers never race with the writer */
+static void StoreTraceEvent(Flow::TraceEvent &slot, const Flow::TraceEvent &event) noexcept
+{
+    std::atomic_ref(slot.begin).store(event.begin, std::memory_order_relaxed);
+    std::atomic_ref(slot.end).store(event.end, std::memory_order_relaxed);
+    std::atomic_ref(slot.name).store(event.name, std::memory_order_relaxed);
+    std::atomic_ref(slot.object).store(event.object, std::memory_order_relaxed);
+    std::atomic_ref(slot.type).store(event.type, std::memory_order_relaxed);
+}
+
+/** @brief Load an event field by field, the result may be torn and must be validated by the sequence */
+[[nodiscard]] static Flow::TraceEvent LoadTraceEvent(Flow::TraceEvent &slot) noexcept
+{
+    return Flow::TraceEvent {
+        .begin = std::atomic_ref(slot.begin).load(std::memory_order_relaxed),
+        .end = std::atomic_ref(slot.end).load(std::memory_order_relaxed),
+        .name = std::atomic_ref(slot.name).load(std::memory_order_relaxed),
+        .object = std::atomic_ref(slot.object).load(std::memory_order_relaxed),
+        .type = std::atomic_ref(slot.type).load(std::memory_order_relaxed)
+    };
+}
+
+/** @brief Write a timestamp in microseconds with nanosecond precision */
+static void WriteChromeTraceTimestamp(std::ostream &stream, const std::int64_t timestamp) noexcept
+{
+    const auto fraction = timestamp % 1000;
+    stream << timestamp / 1000 << '.' << static_cast<char>('0' + fraction / 100)
+        << static_cast<char>('0' + fraction / 10 % 10) << static_cast<char>('0' + fraction % 10);
+}
+
+/** @brief Write a JSON escaped string */
+static void WriteChromeTraceString(std::ostream &stream, const char *string) noexcept
+{
+    constexpr const char *Hexadecimals = "0123456789abcdef";
+
+    stream << '"';
+    for (; *string; ++string) {
+        const auto character = *string;
+        if (character == '"' || character == '\\')
+            stream << '\\' << character;
+        else if (static_cast<unsigned char>(character) < 0x20)
+            stream << "\\u00" << Hexadecimals[character >> 4] << Hexadecimals[character & 0xF];
+        else
+            stream << character;
+    }
+    stream << '"';
+}
+
+std::int64_t Flow::GetTraceTimestamp(void) noexcept
+{
+    return std::chrono::high_resolution_clock::now().time_since_epoch().count();
+}
+
+void Flow::WriteChromeTraceEvent(std::ostream &stream, const TraceEvent &event, const std::size_t threadIndex) noexcept
+{
+    constexpr const char *Categories[] = { "task", "graph", "steal", "sleep" };
+    constexpr const char *DefaultNames[] = { "Task", "Graph", "Steal", "Sleep" };
+
+    const auto type = static_cast<std::size_t>(event.type);
+    stream << "{\"name\":";
+    WriteChromeTraceString(stream, event.name ? event.name : DefaultNames[type]);
+    stream << ",\"cat\":\"" << Categories[type] << "\",\"ph\":\"X\",\"ts\":";
+    WriteChromeTraceTimestamp(stream, event.begin);
+    stream << ",\"dur\":";
+    WriteChromeTraceTimestamp(stream, std::max<std::int64_t>(event.end - event.begin, 0));
+    stream << ",\"pid\":0,\"tid\":" << threadIndex;
+    if (event.type == TraceEventType::Steal)
+        stream << ",\"args\":{\"success\":" << (event.object ? "true" : "false") << '}';
+    stream << '}';
+}
+
+Flow::TraceBuffer::TraceBuffer(const std::size_t capacity) noexcept
+    : _events(static_cast<std::uint32_t>(Core::NextPowerOf2(std::max<std::size_t>(capacity, 1)))),
+    _mask(_events.size() - 1)
+{
+}
+
+void Flow::TraceBuffer::push(const TraceEvent &event) noexcept
+{
+    const auto sequence = _sequence.load(std::memory_order_relaxed);
+    auto &slot = _events[static_cast<std::uint32_t>((sequence / 2) & _mask)];
+
+    // Mark the oldest event as overwritten before writing its slot
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    StoreTraceEvent(slot, event);
+    _sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void Flow::TraceBuffer::collect(TraceEventList &events) noexcept
+{
+    const auto size = capacity();
+    const auto offset = events.size();
+
+    // Copy every published event still inside the buffer
+    const auto published = _sequence.load(std::memory_order_acquire) / 2;
+    const auto from = published > size ? published - size : 0;
+    for (auto index = from; index != published; ++index)
+        events.push(LoadTraceEvent(_events[static_cast<std::uint32_t>(index & _mask)]));
+
+    // Discard the events overwritten by the worker while copying
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto written = (_sequence.load(std::memory_order_relaxed) + 1) / 2;
+    const auto valid = written > size ? written - size : 0;
+    if (valid > from) [[unlikely]] {
+        const auto count = static_cast<std::uint32_t>(std::min(valid, published) - from);
+        events.erase(events.begin() + offset, count);
+    }
+}
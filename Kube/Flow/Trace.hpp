@@ -0,0 +1,83 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flow scheduler tracing
+ */
+
+#pragma once
+
+#include <atomic>
+#include <iosfwd>
+
+#include <Kube/Core/HeapArray.hpp>
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::Flow
+{
+    class TraceBuffer;
+
+    /** @brief Type of a trace event */
+    enum class TraceEventType : std::uint8_t
+    {
+        Task, // Execution of a task by a worker
+        Graph, // Execution of a graph, from its schedule to the end of its last task
+        Steal, // Worker searching for a task to steal, object is the stolen task or null on failure
+        Sleep // Worker sleeping until woken up
+    };
+
+    /** @brief Trace event, spanning from 'begin' to 'end' on a single worker */
+    struct TraceEvent
+    {
+        std::int64_t begin {}; // Begin timestamp in nanoseconds
+        std::int64_t end {}; // End timestamp in nanoseconds
+        const char *name {}; // Optional null-terminated name with static lifetime
+        const void *object {}; // Traced task or graph
+        TraceEventType type {};
+    };
+
+    /** @brief List of trace events */
+    using TraceEventList = Core::Vector<TraceEvent, FlowAllocator>;
+
+    /** @brief Get current timestamp of trace events in nanoseconds (same clock as graph execution times) */
+    [[nodiscard]] std::int64_t GetTraceTimestamp(void) noexcept;
+
+    /** @brief Write a trace event in Chrome trace JSON format (without separator)
+     *  @param threadIndex Index of the worker that recorded the event */
+    void WriteChromeTraceEvent(std::ostream &stream, const TraceEvent &event, const std::size_t threadIndex) noexcept;
+}
+
+/** @brief Lock-free ring buffer of trace events, written by a single worker and readable from any thread
+ *  Once full, the oldest events are overwritten
+ *  The write counter works as a sequence lock: readers discard the events that may have been overwritten while reading */
+class alignas_cacheline kF::Flow::TraceBuffer
+{
+public:
+    /** @brief Destructor */
+    inline ~TraceBuffer(void) noexcept = default;
+
+    /** @brief Constructor, 'capacity' is rounded up to the next power of 2 */
+    TraceBuffer(const std::size_t capacity) noexcept;
+
+    /** @brief TraceBuffer is not copiable */
+    TraceBuffer(const TraceBuffer &other) noexcept = delete;
+    TraceBuffer &operator=(const TraceBuffer &other) noexcept = delete;
+
+
+    /** @brief Get the capacity of the buffer */
+    [[nodiscard]] inline std::size_t capacity(void) const noexcept { return _events.size(); }
+
+
+    /** @brief Push an event, overwriting the oldest one if the buffer is full (must only be called by the owning worker) */
+    void push(const TraceEvent &event) noexcept;
+
+    /** @brief Append a snapshot of the buffer events into 'events', from the oldest to the newest (can be called from any thread) */
+    void collect(TraceEventList &events) noexcept;
+
+private:
+    std::atomic_size_t _sequence {}; // Twice the number of pushed events, odd while an event is being written
+    Core::HeapArray<TraceEvent, FlowAllocator> _events {};
+    std::size_t _mask {};
+};
+
+static_assert_fit_cacheline(kF::Flow::TraceBuffer);
@@ -180,18 +180,15 @@ void UI::UISystem::cancelDrag(void) noexcept
 void UI::UISystem::sortTables(void) noexcept
 {
     const auto &depthTable = getTable<Depth>();
-    const auto ascentCompareFunc = [&depthTable](const ECS::Entity lhs, const ECS::Entity rhs) {
-        return depthTable.get(lhs).depth < depthTable.get(rhs).depth;
-    };
-    const auto descentCompareFunc = [&depthTable](const ECS::Entity lhs, const ECS::Entity rhs) {
-        return depthTable.get(lhs).depth > depthTable.get(rhs).depth;
+    const auto depthKeyFunc = [&depthTable](const ECS::Entity entity) {
+        return depthTable.get(entity).depth;
     };
 
-    getTable<PainterArea>().sort(ascentCompareFunc);
-    getTable<MouseEventArea>().sort(descentCompareFunc);
-    getTable<WheelEventArea>().sort(descentCompareFunc);
-    getTable<DropEventArea>().sort(descentCompareFunc);
-    getTable<KeyEventReceiver>().sort(descentCompareFunc);
+    getTable<PainterArea>().sortByKey(depthKeyFunc);
+    getTable<MouseEventArea>().sortByKey<ECS::SortOrder::Descending>(depthKeyFunc);
+    getTable<WheelEventArea>().sortByKey<ECS::SortOrder::Descending>(depthKeyFunc);
+    getTable<DropEventArea>().sortByKey<ECS::SortOrder::Descending>(depthKeyFunc);
+    getTable<KeyEventReceiver>().sortByKey<ECS::SortOrder::Descending>(depthKeyFunc);
 }
 
 UI::Area UI::UISystem::getClippedArea(const ECS::Entity entity, const UI::Area &area) noexcept